@@ -0,0 +1,109 @@
+#include "seag.hpp"
+
+#include <cstdlib>
+
+/* Write the bytes of an array, 16 per line. */
+void writeBytes(std::ofstream& file, const std::vector<uint8_t>& bytes)
+{
+    file << std::uppercase << std::hex << std::setfill('0');
+    for(size_t i = 0; i < bytes.size(); i++)
+    {
+        if(i % 16 == 0)
+            file << "        ";
+        file << "0x" << std::setw(2) << (int) bytes[i] << ", ";
+        if(i % 16 == 15 || i + 1 == bytes.size())
+            file << "\n";
+    }
+    file << std::dec << std::nouppercase << std::setfill(' ');
+}
+
+/* Format a float as a C++ literal. */
+std::string formatFloat(float value)
+{
+    std::ostringstream stream;
+    stream << std::setprecision(9) << value;
+
+    std::string literal = stream.str();
+    if(literal.find('.') == std::string::npos)
+        literal += ".0";
+    return literal + "f";
+}
+
+/* Generate the header of an atlas: pixels packed 8 per byte and a constexpr table of glyph metrics, so Font neither decodes nor scans it. */
+int main(int argc, char* argv[])
+{
+    if(argc < 4)
+    {
+        std::cout << "usage: atlas_generator <atlas.png> <glyph size> <output.hpp> [name]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string name = argc > 4 ? argv[4] : "CP437";
+    int glyphSize = std::atoi(argv[2]);
+
+    //The font scans the glyph metrics, they are written as they are.
+    seag::Font font(argv[1], glyphSize);
+    const sf::Image& image = font.getImage(0);
+    uint32_t width = image.getSize().x, height = image.getSize().y;
+    if(width == 0 || height == 0)
+    {
+        SEAG_ERROR_LOG("Failed to load atlas " + std::string(argv[1]));
+        return EXIT_FAILURE;
+    }
+
+    //Only black and white atlases can be packed in bits (white is set).
+    std::vector<uint8_t> bits(((size_t) width * height + 7) / 8, 0);
+    const uint8_t* pixels = image.getPixelsPtr();
+    for(size_t i = 0; i < (size_t) width * height; i++)
+    {
+        const uint8_t* pixel = pixels + i * 4;
+        bool white = pixel[0] == 255 && pixel[1] == 255 && pixel[2] == 255 && pixel[3] == 255;
+        bool black = pixel[0] == 0 && pixel[1] == 0 && pixel[2] == 0 && pixel[3] == 255;
+        if(!white && !black)
+        {
+            SEAG_ERROR_LOG("Atlas pixels must be opaque black or white to be packed in bits.");
+            return EXIT_FAILURE;
+        }
+
+        if(white)
+            bits[i / 8] |= 0x80 >> (i % 8);
+    }
+
+    std::ofstream file(argv[3], std::ios::trunc);
+    if(!file)
+    {
+        SEAG_ERROR_LOG("Failed to write " + std::string(argv[3]));
+        return EXIT_FAILURE;
+    }
+
+    std::string prefix = "SEAG_" + name;
+    size_t count = font.getGlyphCount();
+
+    file << "//Generated by atlas_generator from " << argv[1] << ", do not edit.\n";
+    file << "#include \"seag.hpp\"\n\n";
+    file << "#define " << prefix << "_ATLAS_WIDTH " << width << "\n";
+    file << "#define " << prefix << "_ATLAS_HEIGHT " << height << "\n";
+    file << "#define " << prefix << "_ATLAS_SIZE " << bits.size() << "\n";
+    file << "#define " << prefix << "_GLYPH_SIZE " << glyphSize << "\n";
+    file << "#define " << prefix << "_GLYPH_COUNT " << count << "\n\n";
+    file << "namespace seag\n{\n";
+
+    file << "    /* Atlas pixels row by row, 8 per byte from the most significant bit (set for white, opaque black otherwise). */\n";
+    file << "    constexpr uint8_t " << prefix << "_ATLAS[" << prefix << "_ATLAS_SIZE] = {\n";
+    writeBytes(file, bits);
+    file << "    };\n\n";
+
+    //Glyph i is the glyph of character i (x, y, originX, originY, width, height).
+    file << "    /* Metrics of each glyph of the atlas (glyph i is character i). */\n";
+    file << "    constexpr impl::AtlasGlyph " << prefix << "_GLYPHS[" << prefix << "_GLYPH_COUNT] = {\n";
+    for(size_t i = 0; i < count; i++)
+    {
+        const seag::impl::Glyph& glyph = font.getGlyph((char32_t) i);
+        file << "        { " << glyph.coords.x << ", " << glyph.coords.y << ", " << glyph.origin.x << ", " << glyph.origin.y << ", "
+            << formatFloat(glyph.size.x) << ", " << formatFloat(glyph.size.y) << " },\n";
+    }
+    file << "    };\n}\n";
+
+    std::cout << "Wrote " << argv[3] << ": " << width << "x" << height << " atlas in " << bits.size() << " bytes, " << count << " glyphs" << std::endl;
+    return 0;
+}
@@ -0,0 +1,539 @@
+#include "seag.hpp"
+#include "seag_atlas.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+/* Store the result of a benchmark (written to the results file). */
+struct BenchResult
+{
+    std::string name;
+    std::string unit;
+    double value;
+    bool skipped;
+};
+
+std::vector<BenchResult> results;
+bool headless = false; /* Window benchmarks are skipped (no display). */
+
+/* Print a result and keep it for the results file. */
+void report(const std::string& name, const std::string& unit, double value)
+{
+    std::cout << name << ": " << value << " " << unit << std::endl;
+    results.push_back({ name, unit, value, false });
+}
+
+/* Keep a benchmark that could not run in the results file, so runs stay comparable. */
+void skip(const std::string& name, const std::string& unit)
+{
+    std::cout << name << ": skipped" << std::endl;
+    results.push_back({ name, unit, 0, true });
+}
+
+/* Write all results as JSON so runs can be compared. */
+bool writeResults(const std::string& path)
+{
+    std::ofstream file(path);
+    if(!file)
+        return false;
+
+    file << "{\n    \"version\": \"" << SEAG_VERSION << "\",\n    \"results\": [\n";
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        file << "        { \"name\": \"" << results[i].name << "\", \"unit\": \"" << results[i].unit << "\", ";
+        if(results[i].skipped)
+            file << "\"value\": null, \"skipped\": true }";
+        else
+            file << "\"value\": " << results[i].value << " }";
+        file << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "    ]\n}\n";
+
+    return true;
+}
+
+/* Fill a console with text using a style mix (plain, bold, italic, colors or mixed). */
+void fillConsole(seag::Console& console, const std::string& style)
+{
+    uint32_t seed = 1;
+    console.clear();
+
+    for(uint32_t y = 0; y < console.getRows(); y++)
+    {
+        for(uint32_t x = 0; x < console.getColumns(); x++)
+        {
+            seed = seed * 1103515245 + 12345;
+            char32_t code = U'A' + (seed >> 16) % 58;
+
+            console.resetStyle();
+            if(style == "bold" || (style == "mixed" && seed % 4 == 0))
+                console.pushBold(true);
+            if(style == "italic" || (style == "mixed" && seed % 4 == 1))
+                console.pushItalic(true);
+            if(style == "colors" || (style == "mixed" && seed % 4 == 2))
+            {
+                console.pushForegroundColor(sf::Color(seed >> 8));
+                console.pushBackgroundColor(sf::Color((seed >> 4) | 0xFF));
+            }
+
+            console.print(std::u32string_view(&code, 1), x, y);
+        }
+    }
+}
+
+void benchPrint()
+{
+    seag::Console console(200, 60);
+
+    std::string plain;
+    for(int i = 0; i < 190; i++)
+        plain += (char) ('a' + i % 26);
+    plain += '\n';
+
+    std::string markup;
+    for(int i = 0; i < 19; i++)
+        markup += "#ff0000red#r #bbold#b ";
+    markup += '\n';
+
+    //Markup tags are not printed, only the characters they style are counted.
+    seag::StyledText styled(markup);
+    size_t markupCharacters = styled.getCharacters().size();
+
+    struct Case
+    {
+        std::string name;
+        std::function<void()> print;
+        size_t characters;
+    };
+
+    std::vector<Case> cases = {
+        { "print_plain", [&]() { console.print(plain); }, plain.size() },
+        { "print_markup", [&]() { console.print(markup); }, markupCharacters },
+        { "print_styled_text", [&]() { console.print(styled); }, markupCharacters }
+    };
+
+    for(Case& test : cases)
+    {
+        size_t characters = 0;
+        sf::Clock clock;
+
+        while(clock.getElapsedTime() < sf::seconds(0.5f))
+        {
+            console.clear();
+            for(uint32_t y = 0; y < console.getRows(); y++)
+                test.print();
+            characters += test.characters * console.getRows();
+        }
+
+        report(test.name, "chars/s", characters / clock.getElapsedTime().asSeconds());
+    }
+}
+
+void benchRegions()
+{
+    seag::Console console(200, 60);
+
+    //A 5x3 sprite with transparent corners, pasted from a sprite sheet or printed cell by cell.
+    seag::Console sprites(5, 3);
+    sprites.print("#ffff00 /^\\ ", 0, 0);
+    sprites.print("#ffff00<(o)>", 0, 1);
+    sprites.print("#ffff00 \\_/ ", 0, 2);
+    sprites.clearRect({ 0, 0, 1, 1 });
+    sprites.clearRect({ 4, 0, 1, 1 });
+    sprites.clearRect({ 0, 2, 1, 1 });
+    sprites.clearRect({ 4, 2, 1, 1 });
+
+    const std::string lines[3] = { "#ffff00/^\\", "#ffff00<(o)>", "#ffff00\\_/" };
+
+    struct Case
+    {
+        std::string name;
+        std::function<void(uint32_t, uint32_t)> draw;
+    };
+
+    std::vector<Case> cases = {
+        { "blit_sprite", [&](uint32_t x, uint32_t y) { console.blit(sprites, sf::Vector2i(x, y)); } },
+        { "print_sprite", [&](uint32_t x, uint32_t y) {
+            console.print(lines[0], x + 1, y);
+            console.print(lines[1], x, y + 1);
+            console.print(lines[2], x + 1, y + 2);
+        } }
+    };
+
+    for(Case& test : cases)
+    {
+        uint32_t seed = 1;
+        size_t count = 0;
+        sf::Clock clock;
+
+        while(clock.getElapsedTime() < sf::seconds(0.5f))
+        {
+            for(int i = 0; i < 1000; i++)
+            {
+                seed = seed * 1103515245 + 12345;
+                test.draw((seed >> 4) % 195, (seed >> 20) % 57);
+            }
+            count += 1000;
+        }
+
+        report(test.name, "sprites/s", count / clock.getElapsedTime().asSeconds());
+    }
+
+    //Panels filled with a background color, compared with printing spaces.
+    std::string spaces(40, ' ');
+    size_t cells = 0;
+    sf::Clock clock;
+    while(clock.getElapsedTime() < sf::seconds(0.5f))
+    {
+        for(int i = 0; i < 100; i++)
+        {
+            console.pushBackgroundColor(sf::Color(i, 0, 0));
+            console.fillRect({ i % 160, i % 40, 40, 20 }, U' ');
+        }
+        cells += 100 * 40 * 20;
+    }
+    report("fill_rect", "cells/s", cells / clock.getElapsedTime().asSeconds());
+
+    cells = 0;
+    clock.restart();
+    while(clock.getElapsedTime() < sf::seconds(0.5f))
+    {
+        for(int i = 0; i < 100; i++)
+        {
+            console.pushBackgroundColor(sf::Color(i, 0, 0));
+            for(int y = 0; y < 20; y++)
+                console.print(spaces, i % 160, i % 40 + y);
+        }
+        cells += 100 * 40 * 20;
+    }
+    report("fill_print", "cells/s", cells / clock.getElapsedTime().asSeconds());
+}
+
+void benchPrintQueue(unsigned int producers)
+{
+    seag::Console console(200, 60);
+    const int prints = 20000;
+
+    sf::Clock clock;
+    std::vector<std::thread> threads;
+    for(unsigned int i = 0; i < producers; i++)
+    {
+        threads.emplace_back([&console, i]() {
+            seag::Printer printer(console);
+            for(int j = 0; j < prints; j++)
+                printer.print("worker #ff0000status", i % 60);
+        });
+    }
+
+    for(std::thread& thread : threads)
+        thread.join();
+    sf::Time pushTime = clock.restart();
+
+    console.flush();
+    sf::Time flushTime = clock.getElapsedTime();
+
+    report("print_queue_push_" + std::to_string(producers), "prints/s", producers * prints / pushTime.asSeconds());
+    report("print_queue_flush_" + std::to_string(producers), "prints/s", producers * prints / flushTime.asSeconds());
+}
+
+void benchFont()
+{
+    const int iterations = 20;
+    sf::Clock clock;
+
+    for(int i = 0; i < iterations; i++)
+        seag::Font font(seag::SEAG_CP437_ATLAS, SEAG_CP437_ATLAS_WIDTH, SEAG_CP437_ATLAS_HEIGHT, SEAG_CP437_GLYPH_SIZE, seag::SEAG_CP437_GLYPHS, SEAG_CP437_GLYPH_COUNT);
+    report("font_load_cp437", "ms", clock.restart().asMicroseconds() / 1000.0 / iterations);
+
+    //The same atlas decoded and scanned.
+    for(int i = 0; i < iterations; i++)
+        seag::Font font("cp437_atlas.png", SEAG_CP437_GLYPH_SIZE);
+    report("font_load_cp437_png", "ms", clock.restart().asMicroseconds() / 1000.0 / iterations);
+
+    //Another window taking the default font while one uses it.
+    std::shared_ptr<seag::Font> shared = seag::Font::getDefault();
+    clock.restart();
+    for(int i = 0; i < iterations; i++)
+        seag::Font::getDefault();
+    report("font_load_cp437_shared", "ms", clock.restart().asMicroseconds() / 1000.0 / iterations);
+
+    for(int i = 0; i < iterations; i++)
+        seag::Font font("ubuntu_mono_atlas_alpha.png", 32);
+    report("font_load_ubuntu_mono", "ms", clock.restart().asMicroseconds() / 1000.0 / iterations);
+
+    seag::Font cached("ubuntu_mono_atlas_alpha.png", 32, "bench_font.cache");
+    clock.restart();
+    for(int i = 0; i < iterations; i++)
+        seag::Font font("ubuntu_mono_atlas_alpha.png", 32, "bench_font.cache");
+    report("font_load_ubuntu_mono_cached", "ms", clock.restart().asMicroseconds() / 1000.0 / iterations);
+    std::remove("bench_font.cache");
+}
+
+void benchMemory()
+{
+    std::shared_ptr<seag::Font> font = seag::Font::getDefault();
+
+    report("memory_per_cell", "bytes", sizeof(seag::impl::BufferCharacter));
+    report("memory_glyph_table_cp437", "bytes", font->getGlyphCount() * sizeof(seag::impl::Glyph));
+}
+
+void benchRasterizer(uint32_t columns, uint32_t rows, const std::string& style)
+{
+    seag::Console console(columns, rows);
+    seag::Rasterizer rasterizer;
+    sf::Image image;
+
+    fillConsole(console, style);
+
+    int frames = 0;
+    sf::Clock clock;
+    while(clock.getElapsedTime() < sf::seconds(0.5f))
+    {
+        rasterizer.render(console, image);
+        frames++;
+    }
+
+    report("rasterizer_" + std::to_string(columns) + "x" + std::to_string(rows) + "_" + style, "ms/frame", clock.getElapsedTime().asMicroseconds() / 1000.0 / frames);
+}
+
+void benchRecording(uint32_t columns, uint32_t rows, bool compress)
+{
+    seag::Console console(columns, rows);
+    fillConsole(console, "mixed");
+
+    const std::string path = "bench_recording.srec";
+    const int frames = 2000;
+    uint32_t seed = 1;
+
+    seag::Recorder recorder;
+    if(!recorder.start(path, compress))
+        return;
+
+    //Each frame changes a few cells, like a game updating sprites.
+    sf::Clock clock;
+    for(int i = 0; i < frames; i++)
+    {
+        for(int j = 0; j < 100; j++)
+        {
+            seed = seed * 1103515245 + 12345;
+            char32_t code = U'A' + (seed >> 16) % 58;
+            console.resetStyle();
+            console.pushForegroundColor(sf::Color(seed >> 8));
+            console.print(std::u32string_view(&code, 1), (seed >> 4) % columns, (seed >> 20) % rows);
+        }
+        recorder.capture(console);
+    }
+    sf::Time recordTime = clock.getElapsedTime();
+    recorder.stop();
+
+    seag::Player player;
+    seag::Console replay(1, 1);
+    player.open(path);
+    clock.restart();
+    while(player.nextFrame(replay)) {}
+    sf::Time replayTime = clock.getElapsedTime();
+
+    std::string name = "recording_" + std::to_string(columns) + "x" + std::to_string(rows) + (compress ? "_lz" : "_raw");
+    report(name + "_capture", "fps", frames / recordTime.asSeconds());
+    report(name + "_replay", "fps", frames / replayTime.asSeconds());
+    report(name + "_size", "bytes/frame", recorder.getWrittenBytes() / (double) frames);
+    std::remove(path.c_str());
+}
+
+void benchTerminal(uint32_t columns, uint32_t rows)
+{
+    //Sequences are written to /dev/null (a real terminal adds its own drawing time).
+    std::FILE* null = std::fopen("/dev/null", "wb");
+    if(!null)
+        return;
+
+    {
+        seag::Terminal terminal(columns, rows, fileno(null));
+        terminal.setRetainedMode(true);
+        fillConsole(terminal, "mixed");
+        terminal.display();
+        report("terminal_" + std::to_string(columns) + "x" + std::to_string(rows) + "_full", "bytes/frame", terminal.getWrittenBytes());
+
+        //Each frame changes a few cells, only those are written.
+        const int frames = 1000;
+        uint32_t seed = 1;
+        uint64_t written = terminal.getWrittenBytes();
+        sf::Clock clock;
+        for(int i = 0; i < frames; i++)
+        {
+            for(int j = 0; j < 50; j++)
+            {
+                seed = seed * 1103515245 + 12345;
+                char32_t code = U'A' + (seed >> 16) % 58;
+                terminal.resetStyle();
+                terminal.pushForegroundColor(sf::Color(seed >> 8));
+                terminal.print(std::u32string_view(&code, 1), (seed >> 4) % columns, (seed >> 20) % rows);
+            }
+            terminal.display();
+        }
+
+        std::string name = "terminal_" + std::to_string(columns) + "x" + std::to_string(rows) + "_50_cells";
+        report(name, "bytes/frame", (terminal.getWrittenBytes() - written) / (double) frames);
+        report(name + "_time", "ms/frame", clock.getElapsedTime().asMicroseconds() / 1000.0 / frames);
+    }
+
+    std::fclose(null);
+}
+
+void benchDisplay(uint32_t columns, uint32_t rows, const std::string& style, const std::string& mode = "display")
+{
+    std::string name = mode + "_" + std::to_string(columns) + "x" + std::to_string(rows) + "_" + style;
+    if(headless)
+    {
+        skip(name, "ms/frame");
+        return;
+    }
+
+    seag::Window window("bench", columns * 11, rows * 22);
+    window.getNativeWindow().setVerticalSyncEnabled(false);
+    window.setThreaded(mode == "present");
+    if(mode == "grid" && !window.setGridMode(true))
+    {
+        skip(name, "ms/frame");
+        return;
+    }
+
+    int frames = 0;
+    sf::Time displayTime;
+    sf::Clock clock;
+
+    while(clock.getElapsedTime() < sf::seconds(0.5f))
+    {
+        sf::Event event;
+        while(window.pollEvent(event)) {}
+
+        window.clear();
+        fillConsole(window, style);
+
+        sf::Clock displayClock;
+        window.display();
+        displayTime += displayClock.getElapsedTime();
+        frames++;
+    }
+
+    report(name, "ms/frame", displayTime.asMicroseconds() / 1000.0 / frames);
+}
+
+void benchWorld(uint32_t size)
+{
+    std::string name = "world_" + std::to_string(size) + "x" + std::to_string(size);
+    if(headless)
+    {
+        skip(name, "ms/frame");
+        skip(name + "_chunks_drawn", "chunks");
+        skip(name + "_memory", "bytes");
+        return;
+    }
+
+    seag::Window window("bench", 1650, 1100);
+    window.getNativeWindow().setVerticalSyncEnabled(false);
+
+    //Random map, the frame cost should not depend on its size.
+    seag::World world;
+    uint32_t seed = 1;
+    for(uint32_t y = 0; y < size; y += 8)
+    {
+        for(uint32_t x = 0; x < size; x += 8)
+        {
+            seed = seed * 1103515245 + 12345;
+            seag::Brush brush = window.getDefaultBrush();
+            brush.foregroundColor = sf::Color(seed >> 8);
+            world.fillRect({ (int) x, (int) y, 8, 8 }, U'!' + (seed >> 16) % 90, brush);
+        }
+    }
+    window.addWorld(&world);
+
+    //The view moves across the map, a few cells change each frame.
+    sf::Vector2f cell = window.getCellSize();
+    sf::Vector2f viewSize(window.getNativeWindow().getSize());
+    int frames = 0;
+    sf::Clock clock;
+
+    while(clock.getElapsedTime() < sf::seconds(1.f))
+    {
+        sf::Event event;
+        while(window.pollEvent(event)) {}
+
+        world.setCharacter(frames % size, frames % size, U'@', window.getDefaultBrush());
+        world.setView(sf::View({ (frames % size) * cell.x, (frames % size) * cell.y }, viewSize));
+
+        window.clear();
+        window.display();
+        frames++;
+    }
+
+    report(name, "ms/frame", clock.getElapsedTime().asMicroseconds() / 1000.0 / frames);
+    report(name + "_chunks_drawn", "chunks", window.getStats().chunksDrawn);
+    report(name + "_memory", "bytes", world.getMemoryUsage());
+}
+
+int main(int argc, char* argv[])
+{
+    //Window benchmarks need a display (make bench uses xvfb-run and LIBGL_ALWAYS_SOFTWARE=1 on headless hosts), they are written as skipped without one.
+    std::string output = "bench_results.json";
+    headless = std::getenv("DISPLAY") == nullptr;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(std::strcmp(argv[i], "--headless") == 0)
+            headless = true;
+        else
+            output = argv[i];
+    }
+
+    benchPrint();
+    benchRegions();
+
+    //Push throughput should grow with producers (up to the number of cores), there is no global lock.
+    for(unsigned int producers : { 1, 2, 4, 8 })
+        benchPrintQueue(producers);
+
+    benchFont();
+    benchMemory();
+
+    const std::vector<sf::Vector2u> sizes = { { 80, 25 }, { 200, 60 } };
+    const std::vector<std::string> styles = { "plain", "bold", "italic", "colors", "mixed" };
+
+    for(const sf::Vector2u& size : sizes)
+    {
+        for(const std::string& style : styles)
+            benchRasterizer(size.x, size.y, style);
+    }
+
+    for(bool compress : { false, true })
+        benchRecording(120, 40, compress);
+
+    for(const sf::Vector2u& size : sizes)
+        benchTerminal(size.x, size.y);
+
+    for(const sf::Vector2u& size : sizes)
+    {
+        for(const std::string& style : styles)
+            benchDisplay(size.x, size.y, style);
+    }
+
+    //Time left on the main thread when frames are drawn by the render thread.
+    for(const sf::Vector2u& size : sizes)
+        benchDisplay(size.x, size.y, "mixed", "present");
+
+    //One texture update and one quad per frame, compared with the vertex arrays on a large console.
+    for(const char* mode : { "display", "grid" })
+        benchDisplay(400, 150, "mixed", mode);
+
+    //Chunks in the view only, a 16 times larger map should take the same time.
+    for(uint32_t size : { 1000, 4000 })
+        benchWorld(size);
+
+    if(!writeResults(output))
+    {
+        SEAG_ERROR_LOG("Failed to write benchmark results to " + output);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
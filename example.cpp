@@ -6,7 +6,7 @@ int main(int argc, char* argv[])
     seag::Window window("example", 800, 500);
 
     //Change window font.
-    window.setFont(new seag::Font("ubuntu_mono_atlas_alpha.png", 32));
+    window.setFont(seag::Font::load("ubuntu_mono_atlas_alpha.png", 32));
 
     //Change window default background color.
     window.setBackgroundColor(sf::Color(0x191f2aff));
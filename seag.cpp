@@ -1,504 +1,5578 @@
 #include "seag.hpp"
 #include "seag_atlas.hpp"
 
-seag::Font::Font(const std::string& file_path, int glyph_size)
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cerrno>
+#endif
+
+seag::Font::Font(const std::string& file_path, int glyph_size, const std::string& cache_path)
+    : m_fallback({ { 0, 0 }, { 0, 0 }, { 0, 0 }, 0 }),
+    m_fallback_character(SEAG_FALLBACK_CHARACTER),
+    m_glyph_size(glyph_size),
+    m_dynamic(false),
+    m_trueTypeData(nullptr),
+    m_trueTypeSize(0),
+    m_characterSize(0),
+    m_slotSize(0, 0),
+    m_memoryBudget(SEAG_FONT_DYNAMIC_BUDGET),
+    m_frame(0),
+    m_revision(0),
+    m_evictions(0)
 {
-    if(!m_texture.loadFromFile(file_path))
+    //The file is mapped: atlases are decoded from the mapping, TrueType fonts keep it while they are used.
+    std::unique_ptr<impl::MappedFile> file(new impl::MappedFile());
+    if(!file->open(file_path))
+    {
+        SEAG_ERROR_LOG("Failed to open font file " + file_path);
+        return;
+    }
+
+    //TrueType fonts are rasterized on demand instead of scanning an atlas.
+    if(impl::isTrueType(file->getData(), file->getSize()))
+    {
+        m_trueTypePath = file_path;
+        m_trueTypeData = file->getData();
+        m_trueTypeSize = file->getSize();
+        m_trueTypeFile = std::move(file);
+        if(!reloadTrueType())
+            return;
+
+        initDynamic();
+        return;
+    }
+
+    if(!m_image.loadFromMemory(file->getData(), file->getSize()))
     {
         SEAG_ERROR_LOG("Failed to load altas from file " + file_path);
         return;
     }
 
-    m_glyph_size = glyph_size;
-    init();
+    init(cache_path);
 }
 
-seag::Font::Font(const void* data, size_t size, int glyph_size)
+seag::Font::Font(const void* data, size_t size, int glyph_size, const std::string& cache_path)
+    : m_fallback({ { 0, 0 }, { 0, 0 }, { 0, 0 }, 0 }),
+    m_fallback_character(SEAG_FALLBACK_CHARACTER),
+    m_glyph_size(glyph_size),
+    m_dynamic(false),
+    m_trueTypeData(nullptr),
+    m_trueTypeSize(0),
+    m_characterSize(0),
+    m_slotSize(0, 0),
+    m_memoryBudget(SEAG_FONT_DYNAMIC_BUDGET),
+    m_frame(0),
+    m_revision(0),
+    m_evictions(0)
 {
-    if(!m_texture.loadFromMemory(data, size))
+    if(impl::isTrueType((const uint8_t*) data, size))
+    {
+        m_trueTypeData = data;
+        m_trueTypeSize = size;
+        if(!reloadTrueType())
+            return;
+
+        initDynamic();
+        return;
+    }
+
+    if(!m_image.loadFromMemory(data, size))
     {
         SEAG_ERROR_LOG("Failed to load altas from memory 0x" + (uint64_t) data);
         return;
     }
 
-    m_glyph_size = glyph_size;
-    init();
+    init(cache_path);
 }
 
-seag::Font::~Font()
+seag::Font::Font(const uint8_t* bits, uint32_t width, uint32_t height, int glyph_size, const impl::AtlasGlyph* glyphs, size_t glyph_count)
+    : m_fallback({ { 0, 0 }, { 0, 0 }, { 0, 0 }, 0 }),
+    m_fallback_character(SEAG_FALLBACK_CHARACTER),
+    m_glyph_size(glyph_size),
+    m_dynamic(false),
+    m_trueTypeData(nullptr),
+    m_trueTypeSize(0),
+    m_characterSize(0),
+    m_slotSize(0, 0),
+    m_memoryBudget(SEAG_FONT_DYNAMIC_BUDGET),
+    m_frame(0),
+    m_revision(0),
+    m_evictions(0)
 {
-    if(m_glyphs)
-        delete[] m_glyphs;
+    //Bits are set for white pixels, the others are opaque black (like the decoded PNG atlas).
+    std::vector<uint8_t> pixels((size_t) width * height * 4, 255);
+    for(size_t i = 0; i < (size_t) width * height; i++)
+    {
+        if(!(bits[i / 8] & (0x80 >> (i % 8))))
+            std::memset(&pixels[i * 4], 0, 3);
+    }
+    m_image.create(width, height, pixels.data());
+
+    std::vector<impl::Glyph> table(glyph_count);
+    for(size_t i = 0; i < glyph_count; i++)
+        table[i] = { { glyphs[i].x, glyphs[i].y }, { glyphs[i].originX, glyphs[i].originY }, { glyphs[i].width, glyphs[i].height }, 0 };
+
+    loadGlyphs(table);
 }
 
-sf::Texture& seag::Font::getTexture()
+seag::Font::~Font()
 {
-    return m_texture;
 }
 
-sf::Image& seag::Font::getImage()
+std::shared_ptr<seag::Font> seag::Font::load(const std::string& file_path, int glyph_size, const std::string& cache_path)
 {
-    return m_image;
+    return impl::Registry::get().getFont("file:" + std::to_string(glyph_size) + ":" + file_path, [&]() {
+        return new Font(file_path, glyph_size, cache_path);
+    });
 }
 
-seag::impl::Glyph seag::Font::getGlyph(char32_t character)
+std::shared_ptr<seag::Font> seag::Font::load(const void* data, size_t size, int glyph_size, const std::string& cache_path)
 {
-    return m_glyphs[character];
+    //The same data at another address (or a copy of a file in memory) is the same font.
+    uint64_t hash = impl::hashPixels((const uint8_t*) data, size);
+    return impl::Registry::get().getFont("memory:" + std::to_string(glyph_size) + ":" + std::to_string(size) + ":" + std::to_string(hash), [&]() {
+        return new Font(data, size, glyph_size, cache_path);
+    });
 }
 
-int seag::Font::getGlyphSize()
+std::shared_ptr<seag::Font> seag::Font::getDefault()
 {
-    return m_glyph_size;
+    //The embedded atlas is generated with its metrics, it is only unpacked.
+    return impl::Registry::get().getFont("cp437", []() {
+        return new Font(SEAG_CP437_ATLAS, SEAG_CP437_ATLAS_WIDTH, SEAG_CP437_ATLAS_HEIGHT, SEAG_CP437_GLYPH_SIZE, SEAG_CP437_GLYPHS, SEAG_CP437_GLYPH_COUNT);
+    });
 }
 
-void seag::Font::init()
+sf::Texture& seag::Font::getTexture(uint32_t page)
 {
-    //Initialize SFML texture and image.
-    m_texture.setSmooth(false);
-    m_image = m_texture.copyToImage();
-    
-    //Process each glyphs in the atlas and calculate its boundaries.
-    size_t glyphs_count = (m_texture.getSize().x * m_texture.getSize().y) / m_glyph_size;
-    m_glyphs = new impl::Glyph[glyphs_count];
-    char32_t character = 0;
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if(m_dynamic)
+        lock.lock();
+
+    //The texture needs an OpenGL context, so fonts used by the rasterizer only never create it.
+    if(m_textures.size() <= page)
+        m_textures.resize(page + 1);
 
-    for(uint32_t y = 0; y < m_texture.getSize().y; y += m_glyph_size)
+    if(!m_textures[page])
     {
-        for(uint32_t x = 0; x < m_texture.getSize().x; x += m_glyph_size)
-        {
-            m_glyphs[character] = calculateGlyph(x, y);
-            character++;
-        }
+        m_textures[page].reset(new sf::Texture());
+        m_textures[page]->loadFromImage(page == 0 ? m_image : m_pages[page - 1]);
+        m_textures[page]->setSmooth(false);
     }
+
+    return *m_textures[page];
 }
 
-seag::impl::Glyph seag::Font::calculateGlyph(int x, int y)
+sf::Image& seag::Font::getImage(uint32_t page)
 {
-    impl::Glyph glyph = { { x, y }, { 0, 0 }, { m_glyph_size/2.f, (float) m_glyph_size } };
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if(m_dynamic)
+        lock.lock();
 
-    //Define the default bounds of the glyph.
-    int minX = glyph.size.x, maxX = glyph.origin.x;
-    int minY = glyph.size.y, maxY = glyph.origin.y;
-    bool hasPixels = false;
+    return page == 0 ? m_image : m_pages[page - 1];
+}
 
-    //Determine the bounds of the glyph (left, top, width, height).
-    for(int ly = 0; ly < m_glyph_size; ly++)
-    {
-        for(int lx = 0; lx < m_glyph_size; lx++)
-        {
-            sf::Color color = m_image.getPixel(x + lx, y + ly);
+uint32_t seag::Font::getPageCount()
+{
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if(m_dynamic)
+        lock.lock();
 
-            if(color == sf::Color::Black || color.a == 0)
-                continue;
+    return m_pages.size() + 1;
+}
 
-            hasPixels = true;
+const seag::impl::Glyph& seag::Font::getGlyph(char32_t character)
+{
+    if(m_dynamic)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return getDynamicGlyph(character, false, false, nullptr);
+    }
 
-            if(minX > lx)
-                minX = lx;
-            else if(maxX < lx)
-                maxX = lx;
+    const impl::Glyph* glyph = m_glyphs.find(character);
+    return glyph ? *glyph : m_fallback;
+}
 
-            if(minY > ly)
-                minY = ly;
-            else if(maxY < ly)
-                maxY = ly;
-        }
+const seag::impl::Glyph& seag::Font::getGlyph(char32_t character, bool bold, bool italic)
+{
+    if(m_dynamic)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return getDynamicGlyph(character, bold, italic, nullptr);
     }
 
-    if(hasPixels)
+    if(!bold && !italic)
+        return getGlyph(character);
+
+    const impl::Glyph* glyph = m_glyphs.find(character);
+    if(glyph == nullptr)
+        glyph = m_glyphs.find(m_fallback_character);
+    if(glyph == nullptr)
+        return m_fallback;
+
+    return m_variants[m_glyphs.getIndex(glyph) * 3 + (bold && italic ? 2 : italic ? 1 : 0)];
+}
+
+uint32_t seag::Font::getGlyphIndex(char32_t character, bool bold, bool italic)
+{
+    //Dynamic glyphs are indexed by slot (the index of an evicted glyph is reused).
+    if(m_dynamic)
     {
-        glyph.origin = { minX, minY };
-        glyph.size = { (float) abs(maxX - minX) + SEAG_FONT_KERNING, (float) abs(maxY - minY) + 1 };
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint32_t slot;
+        getDynamicGlyph(character, bold, italic, &slot);
+        return 1 + slot;
     }
 
-    return glyph;
+    const impl::Glyph* glyph = m_glyphs.find(character);
+    if(glyph == nullptr)
+        glyph = m_glyphs.find(m_fallback_character);
+    if(glyph == nullptr)
+        return 0;
+
+    //Each atlas glyph has 4 indices: regular, bold, italic and bold italic.
+    return 1 + m_glyphs.getIndex(glyph) * 4 + (bold ? 1 : 0) + (italic ? 2 : 0);
 }
 
-seag::Window::Window()
-    : Window("SEAG " + std::string(SEAG_VERSION), 500, 200)
+const seag::impl::Glyph& seag::Font::getGlyphAt(uint32_t index)
 {
+    if(m_dynamic)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return index == 0 || index > m_slots.size() ? m_fallback : m_slots[index - 1];
+    }
+
+    if(index == 0 || index >= getGlyphIndexCount())
+        return m_fallback;
+
+    size_t glyph = (index - 1) / 4;
+    uint32_t style = (index - 1) % 4;
+    return style == 0 ? m_glyphs.at(glyph) : m_variants[glyph * 3 + style - 1];
 }
 
-seag::Window::Window(const std::string& title, uint32_t width, uint32_t height)
-    : m_window(sf::VideoMode(width, height), title),
-    m_font(new Font(&SEAG_CP437_ATLAS, SEAG_CP437_ATLAS_SIZE, 10)),
-    m_fontSize(11),
-    m_cursor(0, 0),
-    m_default_brush({sf::Color::White, sf::Color::Black, false, false}),
-    m_active_brush(m_default_brush)
+uint32_t seag::Font::getGlyphIndexCount()
 {
-    m_window.setVerticalSyncEnabled(true);
-
-    //TODO : Move shaders to const string to avoid carrying files around.
-    if(!m_shader.loadFromMemory(impl::vertexShader, impl::fragmentShader))
+    if(m_dynamic)
     {
-        SEAG_FATAL_LOG("Could not load rendering shader files.");
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return 1 + m_slots.size();
     }
-    m_shader.setUniform("texture", sf::Shader::CurrentTexture);
+
+    return 1 + m_glyphs.getCount() * 4;
 }
 
-seag::Window::~Window()
+bool seag::Font::hasGlyph(char32_t character)
 {
-    if(m_font)
-        delete m_font;
+    //Characters missing from a TrueType font are drawn with its replacement glyph.
+    if(m_dynamic)
+        return true;
+
+    return m_glyphs.find(character) != nullptr;
 }
 
-sf::RenderWindow& seag::Window::getNativeWindow()
+size_t seag::Font::getGlyphCount()
 {
-    return m_window;
+    if(m_dynamic)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_dynamicGlyphs.size();
+    }
+
+    return m_glyphs.getCount();
 }
 
-seag::Font* seag::Window::getFont()
+size_t seag::Font::getGlyphMemoryUsage()
 {
-    return m_font;
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if(m_dynamic)
+        lock.lock();
+
+    //Nodes of the dynamic glyphs map and LRU list are counted with two pointers each.
+    size_t dynamic = m_slots.size() * sizeof(impl::Glyph)
+        + m_dynamicGlyphs.size() * (sizeof(std::pair<const uint64_t, impl::DynamicGlyph>) + sizeof(uint64_t) + 4 * sizeof(void*))
+        + m_freeSlots.capacity() * sizeof(uint32_t);
+
+    return m_glyphs.getMemoryUsage() + m_variants.capacity() * sizeof(impl::Glyph) + dynamic;
 }
 
-void seag::Window::setFont(Font* font)
+int seag::Font::getGlyphSize()
 {
-    m_font = font;
+    return m_glyph_size;
 }
 
-int seag::Window::getFontSize()
+bool seag::Font::isDynamic()
 {
-    return m_fontSize;
+    return m_dynamic;
 }
 
-void seag::Window::setFontSize(int fontSize)
+size_t seag::Font::getMemoryBudget()
 {
-    m_fontSize = fontSize;
+    return m_memoryBudget;
 }
 
-sf::Vector2f seag::Window::getCellSize()
+void seag::Font::setMemoryBudget(size_t budget)
 {
-    return { (float) m_fontSize, m_fontSize * 2.f };
+    //Pages already added are kept, glyphs are evicted once they are full.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryBudget = budget;
 }
 
-sf::Vector2f seag::Window::getCursor()
+void seag::Font::update()
 {
-    return m_cursor;
+    if(!m_dynamic)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_frame++;
+
+    if(!m_pending.empty())
+    {
+        //The TrueType font keeps its glyphs in a texture, it is read back once for all the glyphs of the frame.
+        sf::Image source = m_trueType.getTexture(m_characterSize).copyToImage();
+        const uint8_t* sourcePixels = source.getPixelsPtr();
+        sf::Vector2u sourceSize = source.getSize();
+        std::vector<float> row;
+
+        for(const impl::PendingGlyph& pending : m_pending)
+        {
+            const impl::Glyph& glyph = m_slots[pending.slot];
+            sf::Image& page = glyph.page == 0 ? m_image : m_pages[glyph.page - 1];
+
+            //The slot may hold an evicted glyph larger than this one.
+            for(int y = 0; y < m_slotSize.y; y++)
+            {
+                for(int x = 0; x < m_slotSize.x; x++)
+                    page.setPixel(glyph.coords.x + x, glyph.coords.y + y, sf::Color::Black);
+            }
+
+            const sf::IntRect& rect = pending.textureRect;
+            if(rect.left < 0 || rect.top < 0 || rect.left + rect.width > (int) sourceSize.x || rect.top + rect.height > (int) sourceSize.y)
+                continue;
+
+            for(int y = 0; y < rect.height; y++)
+            {
+                //Italic glyphs are skewed around their bottom row, the coverage is split between the two pixels under each shifted pixel.
+                float shift = pending.italic ? SEAG_ITALIC_SKEW * (rect.height - 1 - y) : 0.f;
+                int offset = (int) shift;
+                float weight = shift - offset;
+
+                row.assign((size_t) glyph.size.x + 2, 0.f);
+                for(int x = 0; x < rect.width; x++)
+                {
+                    //TrueType glyphs are white, their alpha is the coverage.
+                    float coverage = sourcePixels[((size_t) (rect.top + y) * sourceSize.x + rect.left + x) * 4 + 3];
+                    row[x + offset] += coverage * (1.f - weight);
+                    row[x + offset + 1] += coverage * weight;
+                }
+
+                for(int x = 0; x < (int) glyph.size.x && glyph.origin.x + x < m_slotSize.x; x++)
+                {
+                    uint8_t value = std::min(255.f, row[x] + 0.5f);
+                    page.setPixel(glyph.coords.x + glyph.origin.x + x, glyph.coords.y + glyph.origin.y + y, sf::Color(value, value, value));
+                }
+            }
+        }
+        m_pending.clear();
+
+        //The TrueType font never drops glyphs, it is loaded again when its texture goes over the budget.
+        if((size_t) sourceSize.x * sourceSize.y * 4 > m_memoryBudget)
+            reloadTrueType();
+    }
+
+    //Changed areas are uploaded with one texture update per page.
+    std::vector<uint8_t> pixels;
+    for(uint32_t page = 0; page < m_dirtyRects.size(); page++)
+    {
+        sf::IntRect& rect = m_dirtyRects[page];
+        if(rect.width <= 0 || rect.height <= 0)
+            continue;
+
+        if(page < m_textures.size() && m_textures[page])
+        {
+            const sf::Image& image = page == 0 ? m_image : m_pages[page - 1];
+            const uint8_t* imagePixels = image.getPixelsPtr();
+
+            pixels.resize((size_t) rect.width * rect.height * 4);
+            for(int y = 0; y < rect.height; y++)
+                std::memcpy(pixels.data() + (size_t) y * rect.width * 4, imagePixels + ((size_t) (rect.top + y) * image.getSize().x + rect.left) * 4, (size_t) rect.width * 4);
+
+            m_textures[page]->update(pixels.data(), rect.width, rect.height, rect.left, rect.top);
+        }
+
+        rect = sf::IntRect();
+    }
 }
 
-void seag::Window::setCursor(sf::Vector2f cursor)
+uint64_t seag::Font::getRevision()
 {
-    m_cursor = cursor;
+    return m_revision;
 }
 
-std::map<uint32_t, std::map<uint32_t, seag::impl::BufferCharacter>>& seag::Window::getScreenBuffer()
+uint64_t seag::Font::getEvictionCount()
 {
-    return m_screenBuffer;
+    return m_evictions;
 }
 
-void seag::Window::setScreenBuffer(std::map<uint32_t, std::map<uint32_t, seag::impl::BufferCharacter>>& buffer)
+char32_t seag::Font::getFallbackCharacter()
 {
-    m_screenBuffer = buffer;
+    return m_fallback_character;
 }
 
-std::u32string seag::Window::getLine(uint32_t y)
+void seag::Font::setFallbackCharacter(char32_t character)
 {
-    std::u32string line = U"";
-    int previousX = -1;
+    m_fallback_character = character;
+
+    //Missing fallback is drawn as an empty glyph.
+    const impl::Glyph* glyph = m_glyphs.find(character);
+    m_fallback = glyph ? *glyph : impl::Glyph{ { 0, 0 }, { 0, 0 }, { 0, 0 }, 0 };
+}
+
+void seag::Font::init(const std::string& cache_path)
+{
+    //Glyphs are numbered row by row in the atlas.
+    uint32_t columns = m_image.getSize().x / m_glyph_size;
+    uint32_t rows = m_image.getSize().y / m_glyph_size;
+    std::vector<impl::Glyph> glyphs;
 
-    for(auto &[x,bufferChar] : m_screenBuffer.at(y))
+    //Use the cached metrics if they were computed for the same atlas and glyph size.
+    uint64_t hash = 0;
+    if(!cache_path.empty())
     {
-        if(previousX != -1 && x - previousX > 1)
-            break;
+        hash = impl::hashPixels(m_image.getPixelsPtr(), (size_t) m_image.getSize().x * m_image.getSize().y * 4);
+        loadMetrics(cache_path, hash, glyphs);
+    }
 
-        if(bufferChar.code == 0)
-            break;
+    if(glyphs.size() != (size_t) columns * rows)
+    {
+        //Process each glyphs row in the atlas and calculate its boundaries, rows are split between threads.
+        glyphs.resize((size_t) columns * rows);
 
-        line += bufferChar.code;
-        previousX = x;
+        uint32_t threadCount = std::min<uint32_t>(std::max(1u, std::thread::hardware_concurrency()), rows);
+        if((size_t) m_image.getSize().x * m_image.getSize().y < SEAG_FONT_THREADING_THRESHOLD)
+            threadCount = 1;
 
-        if(bufferChar.code == U'\n')
-            break;
+        std::vector<std::thread> threads;
+        for(uint32_t i = 1; i < threadCount; i++)
+            threads.emplace_back(&Font::calculateGlyphs, this, std::ref(glyphs), rows * i / threadCount, rows * (i + 1) / threadCount);
+
+        calculateGlyphs(glyphs, 0, rows / threadCount);
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        if(!cache_path.empty())
+            saveMetrics(cache_path, hash, glyphs);
     }
 
-    return line;
+    loadGlyphs(glyphs);
 }
 
-std::u32string seag::Window::getText(uint32_t y)
+void seag::Font::loadGlyphs(const std::vector<impl::Glyph>& glyphs)
 {
-    std::u32string line = U"";
-    bool exit = false;
-    int previousX = -1;
+    m_glyphs.clear();
+    for(size_t i = 0; i < glyphs.size(); i++)
+        m_glyphs.insert(i, glyphs[i]);
+
+    setFallbackCharacter(m_fallback_character);
+    bakeVariants();
+}
+
+void seag::Font::bakeVariants()
+{
+    m_variants.assign(m_glyphs.getCount() * 3, impl::Glyph{ { 0, 0 }, { 0, 0 }, { 0, 0 }, 0 });
+    m_pages.clear();
+    m_textures.clear();
+
+    //Variants are packed in shelves first, a page is closed when the next shelf does not fit.
+    std::vector<int> pageHeights;
+    int shelfX = 0, shelfY = 0, shelfHeight = 0;
 
-    do
+    for(size_t i = 0; i < m_glyphs.getCount(); i++)
     {
-        for(auto &[x,bufferChar] : m_screenBuffer.at(y))
+        const impl::Glyph& glyph = m_glyphs.at(i);
+        int width = glyph.size.x, height = glyph.size.y;
+
+        //Empty glyphs stay empty.
+        if(width <= 0 || height <= 0 || width + getBoldDilation() + 2 + height > SEAG_FONT_PAGE_SIZE)
+        {
+            for(int style = 0; style < 3; style++)
+                m_variants[i * 3 + style] = glyph;
+            continue;
+        }
+
+        for(int style = 0; style < 3; style++)
         {
-            if(previousX != -1 && x - previousX > 1)
+            //Italic rows are shifted by up to (height - 1) * skew, plus 1px for the filter.
+            int baseWidth = style == 1 ? width : width + getBoldDilation();
+            int variantWidth = style > 0 ? baseWidth + (int) std::ceil((height - 1) * SEAG_ITALIC_SKEW) + 1 : baseWidth;
+
+            //Place the variant in the current shelf, page or a new one (1px apart so filtering never reads a neighbour).
+            if(shelfX + variantWidth > SEAG_FONT_PAGE_SIZE)
             {
-                exit = true;
-                break;
+                shelfX = 0;
+                shelfY += shelfHeight + 1;
+                shelfHeight = 0;
             }
-
-            if(bufferChar.code == 0)
+            if(shelfY + height > SEAG_FONT_PAGE_SIZE)
             {
-                exit = true;
-                break;
+                pageHeights.push_back(shelfY + shelfHeight);
+                shelfX = shelfY = shelfHeight = 0;
             }
 
-            line += bufferChar.code;
-            previousX = x;
+            m_variants[i * 3 + style] = impl::Glyph{
+                { shelfX, shelfY - glyph.origin.y },
+                { 0, glyph.origin.y },
+                { (float) variantWidth, (float) height },
+                (uint32_t) pageHeights.size() + 1
+            };
 
-            if(bufferChar.code == U'\n')
-            {
-                y++;
-                break;
-            }
+            shelfX += variantWidth + 1;
+            shelfHeight = std::max(shelfHeight, height);
         }
     }
-    while(!exit);
 
-    return line;
-}
+    if(shelfX > 0 || shelfY > 0)
+        pageHeights.push_back(shelfY + shelfHeight);
 
-seag::impl::BufferCharacter seag::Window::getCharacter(uint32_t x, uint32_t y)
-{
-    return m_screenBuffer.at(y).at(x);
+    //Variants are then drawn in their place, glyphs are split between threads.
+    std::vector<std::vector<uint8_t>> pages(pageHeights.size());
+    for(size_t i = 0; i < pages.size(); i++)
+        pages[i].assign((size_t) SEAG_FONT_PAGE_SIZE * pageHeights[i], 0);
+
+    size_t count = m_glyphs.getCount();
+    uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    if((size_t) m_image.getSize().x * m_image.getSize().y < SEAG_FONT_THREADING_THRESHOLD)
+        threadCount = 1;
+
+    std::vector<std::thread> threads;
+    for(uint32_t i = 1; i < threadCount; i++)
+        threads.emplace_back(&Font::drawVariants, this, std::ref(pages), count * i / threadCount, count * (i + 1) / threadCount);
+
+    drawVariants(pages, 0, count / threadCount);
+
+    for(std::thread& thread : threads)
+        thread.join();
+
+    for(size_t i = 0; i < pages.size(); i++)
+    {
+        std::vector<uint8_t> pixels(pages[i].size() * 4);
+        for(size_t j = 0; j < pages[i].size(); j++)
+        {
+            pixels[j * 4] = pixels[j * 4 + 1] = pixels[j * 4 + 2] = pages[i][j];
+            pixels[j * 4 + 3] = 255;
+        }
+
+        m_pages.emplace_back();
+        m_pages.back().create(SEAG_FONT_PAGE_SIZE, pageHeights[i], pixels.data());
+    }
 }
 
-void seag::Window::print(std::u32string str)
+void seag::Font::drawVariants(std::vector<std::vector<uint8_t>>& pages, size_t first, size_t last)
 {
-    bool escaped = false;
+    //Bold glyphs are dilated to the right, italic glyphs are skewed around the middle of the cell.
+    int dilation = getBoldDilation();
+    const uint8_t* atlas = m_image.getPixelsPtr();
+    int atlasWidth = m_image.getSize().x;
+
+    std::vector<uint8_t> source, bold;
 
-    for (uint32_t i = 0; i < str.size(); i++)
+    for(size_t i = first; i < last; i++)
     {
-        if(str[i] == SEAG_STYLE_ESCAPE)
-        {
-            escaped = true;
+        const impl::Glyph& glyph = m_glyphs.at(i);
+        int width = glyph.size.x, height = glyph.size.y;
+
+        //Skip glyphs that were not packed.
+        if(m_variants[i * 3].page == 0)
             continue;
+
+        //Brightness of the glyph (see impl::fragmentShader).
+        source.resize((size_t) width * height);
+        for(int y = 0; y < height; y++)
+        {
+            const uint8_t* pixel = atlas + ((size_t) (glyph.coords.y + glyph.origin.y + y) * atlasWidth + glyph.coords.x + glyph.origin.x) * 4;
+            for(int x = 0; x < width; x++, pixel += 4)
+                source[y * width + x] = (pixel[0] + pixel[1] + pixel[2]) / 3;
         }
 
-        if(!escaped)
+        int boldWidth = width + dilation;
+        bold.assign((size_t) boldWidth * height, 0);
+        for(int y = 0; y < height; y++)
         {
-            if(str[i] == SEAG_STYLE)
+            for(int x = 0; x < boldWidth; x++)
             {
-                if(str.length() - i > 0)
-                {
-                    if(str[i+1] == SEAG_STYLE_RESET)
-                        resetStyle();
-                    else if(str[i+1] == SEAG_STYLE_BOLD)
-                        pushBold(!m_active_brush.bold);
-                    else if(str[i+1] == SEAG_STYLE_ITALIC)
-                        pushItalic(!m_active_brush.italic);
-                    else
-                        goto After;
-
-                    i++;
-                    continue;
-                }
+                uint8_t value = 0;
+                for(int k = std::max(0, x - width + 1); k <= std::min(dilation, x); k++)
+                    value = std::max(value, source[y * width + x - k]);
+                bold[y * boldWidth + x] = value;
+            }
+        }
 
-                After:
+        float bottomShift = (m_glyph_size / 2.f - (glyph.origin.y + height - 0.5f)) * SEAG_ITALIC_SKEW;
 
-                int codeLength = (str.length() - i > 6 && str[i+1] == SEAG_STYLE_BACKGROUND) ? 7 : 6;
-                if(str.length() - i < codeLength)
-                    continue;
+        for(int style = 0; style < 3; style++)
+        {
+            const impl::Glyph& variant = m_variants[i * 3 + style];
+            const std::vector<uint8_t>& base = style == 1 ? source : bold;
+            int baseWidth = style == 1 ? width : boldWidth;
+            int variantWidth = variant.size.x;
+            uint8_t* page = pages[variant.page - 1].data() + (size_t) (variant.coords.y + variant.origin.y) * SEAG_FONT_PAGE_SIZE + variant.coords.x;
 
-                std::u32string c = str.substr(i + 1, codeLength);
-                std::string code = std::string(c.begin(), c.end());
+            for(int y = 0; y < height; y++)
+            {
+                uint8_t* row = page + (size_t) y * SEAG_FONT_PAGE_SIZE;
+                const uint8_t* baseRow = base.data() + (size_t) y * baseWidth;
 
-                if(code[0] == SEAG_STYLE_BACKGROUND)
+                if(style == 0)
                 {
-                    //Change active brush background color.
-                    unsigned int hex;
-                    std::stringstream ss;
-                    ss << std::hex << (code.substr(1, code.length() - 1) + "FF");
-                    ss >> hex;
-                    pushBackgroundColor(sf::Color(hex));
+                    std::copy(baseRow, baseRow + baseWidth, row);
+                    continue;
                 }
-                else
+
+                //Rows are shifted by (middle of the cell - row) * skew, with a linear filter between two pixels (8 bits weights).
+                float shift = (m_glyph_size / 2.f - (glyph.origin.y + y + 0.5f)) * SEAG_ITALIC_SKEW - bottomShift;
+                int offset = std::floor(shift);
+                uint32_t weight = std::lround((shift - offset) * 256);
+
+                for(int x = 0; x < variantWidth; x++)
                 {
-                    //Change active brush foreground color.
-                    unsigned int hex;
-                    std::stringstream ss;
-                    ss << std::hex << (code + "FF");
-                    ss >> hex;
-                    pushForegroundColor(sf::Color(hex));
+                    int left = x - offset - 1, right = x - offset;
+                    uint32_t value = (right >= 0 && right < baseWidth ? baseRow[right] * (256 - weight) : 0)
+                        + (left >= 0 && left < baseWidth ? baseRow[left] * weight : 0);
+                    row[x] = std::min<uint32_t>((value + 128) >> 8, 255);
                 }
-
-                i += codeLength;
-                continue;
             }
         }
+    }
+}
 
-        impl::BufferCharacter bufferCharacter = { str[i], m_active_brush };
+void seag::Font::initDynamic()
+{
+    m_dynamic = true;
 
-        if(bufferCharacter.code == U'\t')
-        {
-            bufferCharacter = impl::BufferCharacter{ U' ', m_active_brush };
-            for(int i = 0; i < 4; i++)
-                m_screenBuffer[m_cursor.y][m_cursor.x+i] = bufferCharacter;
-            m_cursor.x += 4;
-        }
-        else if(bufferCharacter.code == U'\n')
-        {
-            m_cursor = { 0, m_cursor.y + 1 };
-        }
-        else
-        {
-            m_screenBuffer[m_cursor.y][m_cursor.x] = bufferCharacter;
-            m_cursor.x++;
-        }
+    //A line of the TrueType font fills the glyph size, the baseline is at the same height in each slot.
+    float spacing = m_trueType.getLineSpacing(m_glyph_size);
+    m_characterSize = spacing > 0 ? std::max(1l, std::lround(m_glyph_size * m_glyph_size / spacing)) : m_glyph_size;
 
-        escaped = false;
-    }   
-}
+    //Slots fit a square glyph with its italic skew and a pixel of padding on each side.
+    m_slotSize = { m_glyph_size + (int) std::ceil(m_glyph_size * SEAG_ITALIC_SKEW) + 2, m_glyph_size };
+    if(m_slotSize.x > SEAG_FONT_DYNAMIC_PAGE_SIZE || m_slotSize.y > SEAG_FONT_DYNAMIC_PAGE_SIZE)
+    {
+        SEAG_ERROR_LOG("Glyph size " + std::to_string(m_glyph_size) + " does not fit in a font page.");
+        m_slotSize = { 0, 0 };
+        return;
+    }
 
-void seag::Window::print(std::u32string str, uint32_t y)
-{
-    print(str, 0, y);
-}
+    //The first page is the atlas image, others are added when slots run out.
+    m_image.create(SEAG_FONT_DYNAMIC_PAGE_SIZE, SEAG_FONT_DYNAMIC_PAGE_SIZE, sf::Color::Black);
+    m_dirtyRects.assign(1, sf::IntRect());
+    for(int y = 0; y + m_slotSize.y <= SEAG_FONT_DYNAMIC_PAGE_SIZE; y += m_slotSize.y)
+    {
+        for(int x = 0; x + m_slotSize.x <= SEAG_FONT_DYNAMIC_PAGE_SIZE; x += m_slotSize.x)
+            m_slots.push_back({ { x, y }, { 0, 0 }, { 0, 0 }, 0 });
+    }
 
-void seag::Window::print(std::u32string str, uint32_t x, uint32_t y)
-{
-    m_cursor = { (float) x, (float) y };
-    print(str);
+    //Free slots are taken from the back, so glyphs fill the pages in order.
+    for(uint32_t slot = m_slots.size(); slot > 0; slot--)
+        m_freeSlots.push_back(slot - 1);
 }
 
-void seag::Window::print(std::string str)
+bool seag::Font::reloadTrueType()
 {
-    print(std::u32string(str.begin(), str.end()));
-}
+    //Fonts loaded from a path read their mapped file.
+    bool loaded = m_trueType.loadFromMemory(m_trueTypeData, m_trueTypeSize);
+    if(!loaded)
+        SEAG_ERROR_LOG("Failed to load TrueType font " + (m_trueTypePath.empty() ? std::string("from memory") : m_trueTypePath));
 
-void seag::Window::print(std::string str, uint32_t y)
-{
-    print(std::u32string(str.begin(), str.end()), y);
+    return loaded;
 }
 
-void seag::Window::print(std::string str, uint32_t x, uint32_t y)
+const seag::impl::Glyph& seag::Font::getDynamicGlyph(char32_t character, bool bold, bool italic, uint32_t* slot)
 {
-    print(std::u32string(str.begin(), str.end()), x, y);
-}
+    uint64_t key = impl::getBitmapKey(character, bold, italic);
+    auto it = m_dynamicGlyphs.find(key);
+    if(it != m_dynamicGlyphs.end())
+    {
+        //Glyphs are moved to the front of the LRU list once per frame.
+        impl::DynamicGlyph& dynamic = it->second;
+        if(dynamic.lastFrame != m_frame)
+        {
+            dynamic.lastFrame = m_frame;
+            m_lru.splice(m_lru.begin(), m_lru, dynamic.lru);
+        }
 
-void seag::Window::setForegroundColor(sf::Color color)
-{
-    //Change active color to new color if it wasn't changed.
-    if(m_active_brush.foregroundColor == m_default_brush.foregroundColor)
-        m_active_brush.foregroundColor = color;
+        if(slot)
+            *slot = dynamic.slot;
+        return m_slots[dynamic.slot];
+    }
 
-    m_default_brush.foregroundColor = color;
-}
+    if(m_slotSize.x == 0)
+    {
+        if(slot)
+            *slot = m_slots.size();
+        return m_fallback;
+    }
 
-void seag::Window::setBackgroundColor(sf::Color color)
-{
-    //Change active color to new color if it wasn't changed.
-    if(m_active_brush.backgroundColor == m_default_brush.backgroundColor)
-        m_active_brush.backgroundColor = color;
+    //The TrueType font rasterizes the glyph in its texture, pixels are copied to the slot by update().
+    const sf::Glyph& source = m_trueType.getGlyph(character, m_characterSize, bold);
+    uint32_t index = allocateSlot();
+    impl::Glyph& glyph = m_slots[index];
 
-    m_default_brush.backgroundColor = color;
-}
+    //Rows above or below the slot are clipped, the width leaves room for the italic skew.
+    sf::IntRect rect = source.textureRect;
+    int top = std::lround(m_glyph_size * SEAG_FONT_BASELINE) + (int) std::floor(source.bounds.top);
+    if(top < 0)
+    {
+        rect.top -= top;
+        rect.height += top;
+        top = 0;
+    }
+    rect.height = std::min(rect.height, m_slotSize.y - top);
 
-void seag::Window::pushForegroundColor(sf::Color color)
-{
-    m_active_brush.foregroundColor = color;
-}
+    int skew = italic ? (int) std::ceil(SEAG_ITALIC_SKEW * std::max(rect.height - 1, 0)) : 0;
+    rect.width = std::min(rect.width, m_slotSize.x - 2 - skew);
 
-void seag::Window::pushBackgroundColor(sf::Color color)
-{
-    m_active_brush.backgroundColor = color;
-}
+    if(rect.width <= 0 || rect.height <= 0)
+    {
+        glyph.origin = { 0, 0 };
+        glyph.size = { 0, 0 };
+    }
+    else
+    {
+        glyph.origin = { 1, top };
+        glyph.size = { (float) rect.width + skew, (float) rect.height };
+    }
 
-void seag::Window::pushBold(bool bold)
-{
-    m_active_brush.bold = bold;
-}
+    m_pending.push_back({ index, rect, italic });
+    m_revision++;
 
-void seag::Window::pushItalic(bool italic)
-{
-    m_active_brush.italic = italic;
-}
+    //The whole slot is cleared, so it is uploaded.
+    sf::IntRect& dirty = m_dirtyRects[glyph.page];
+    sf::IntRect area = { glyph.coords.x, glyph.coords.y, m_slotSize.x, m_slotSize.y };
+    if(dirty.width <= 0 || dirty.height <= 0)
+        dirty = area;
+    else
+    {
+        int left = std::min(dirty.left, area.left), top = std::min(dirty.top, area.top);
+        int right = std::max(dirty.left + dirty.width, area.left + area.width), bottom = std::max(dirty.top + dirty.height, area.top + area.height);
+        dirty = { left, top, right - left, bottom - top };
+    }
 
-void seag::Window::resetStyle()
-{
-    m_active_brush = m_default_brush;
+    m_lru.push_front(key);
+    m_dynamicGlyphs[key] = { index, m_frame, m_lru.begin() };
+
+    if(slot)
+        *slot = index;
+    return glyph;
 }
 
-bool seag::Window::isOpen()
+uint32_t seag::Font::allocateSlot()
+{
+    if(m_freeSlots.empty())
+    {
+        //Glyphs used by the current or the previous frame may still be drawn, so a page is added over the budget instead of evicting them.
+        size_t pageBytes = (size_t) SEAG_FONT_DYNAMIC_PAGE_SIZE * SEAG_FONT_DYNAMIC_PAGE_SIZE * 4;
+        bool evictable = !m_lru.empty() && m_dynamicGlyphs[m_lru.back()].lastFrame + 1 < m_frame;
+
+        if(!evictable || (m_pages.size() + 2) * pageBytes <= m_memoryBudget)
+        {
+            uint32_t page = m_pages.size() + 1;
+            m_pages.emplace_back();
+            m_pages.back().create(SEAG_FONT_DYNAMIC_PAGE_SIZE, SEAG_FONT_DYNAMIC_PAGE_SIZE, sf::Color::Black);
+            m_dirtyRects.push_back(sf::IntRect());
+
+            size_t first = m_slots.size();
+            for(int y = 0; y + m_slotSize.y <= SEAG_FONT_DYNAMIC_PAGE_SIZE; y += m_slotSize.y)
+            {
+                for(int x = 0; x + m_slotSize.x <= SEAG_FONT_DYNAMIC_PAGE_SIZE; x += m_slotSize.x)
+                    m_slots.push_back({ { x, y }, { 0, 0 }, { 0, 0 }, page });
+            }
+
+            for(size_t slot = m_slots.size(); slot > first; slot--)
+                m_freeSlots.push_back(slot - 1);
+        }
+        else
+        {
+            auto it = m_dynamicGlyphs.find(m_lru.back());
+            m_freeSlots.push_back(it->second.slot);
+            m_dynamicGlyphs.erase(it);
+            m_lru.pop_back();
+            m_evictions++;
+        }
+    }
+
+    uint32_t slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    return slot;
+}
+
+int seag::Font::getBoldDilation() const
+{
+    //About 2px at the default font size.
+    return std::max(1, (int) std::lround(m_glyph_size / 16.0));
+}
+
+void seag::Font::calculateGlyphs(std::vector<impl::Glyph>& glyphs, uint32_t first_row, uint32_t last_row)
+{
+    uint32_t columns = m_image.getSize().x / m_glyph_size;
+
+    for(uint32_t y = first_row; y < last_row; y++)
+    {
+        for(uint32_t x = 0; x < columns; x++)
+            glyphs[(size_t) y * columns + x] = calculateGlyph(x * m_glyph_size, y * m_glyph_size);
+    }
+}
+
+seag::impl::Glyph seag::Font::calculateGlyph(int x, int y)
+{
+    impl::Glyph glyph = { { x, y }, { 0, 0 }, { m_glyph_size/2.f, (float) m_glyph_size }, 0 };
+
+    //Bounds start empty so any pixel of the cell can be the left or top edge.
+    int minX = m_glyph_size, maxX = 0;
+    int minY = m_glyph_size, maxY = 0;
+    bool hasPixels = false;
+
+    const uint8_t* pixels = m_image.getPixelsPtr();
+    size_t stride = (size_t) m_image.getSize().x * 4;
+
+    //Determine the bounds of the glyph (left, top, width, height).
+    for(int ly = 0; ly < m_glyph_size; ly++)
+    {
+        int first, last;
+        if(!impl::findPixels(pixels + (y + ly) * stride + x * 4, m_glyph_size, first, last))
+            continue;
+
+        hasPixels = true;
+        minX = std::min(minX, first);
+        maxX = std::max(maxX, last);
+        minY = std::min(minY, ly);
+        maxY = std::max(maxY, ly);
+    }
+
+    if(hasPixels)
+    {
+        glyph.origin = { minX, minY };
+        glyph.size = { (float) abs(maxX - minX) + SEAG_FONT_KERNING, (float) abs(maxY - minY) + 1 };
+    }
+
+    return glyph;
+}
+
+bool seag::Font::loadMetrics(const std::string& cache_path, uint64_t hash, std::vector<impl::Glyph>& glyphs)
+{
+    std::ifstream file(cache_path, std::ios::binary);
+    if(!file)
+        return false;
+
+    //Header: magic, version, atlas hash, glyph size and glyph count.
+    char magic[4];
+    uint32_t version, count;
+    uint64_t fileHash;
+    int32_t glyphSize;
+
+    file.read(magic, 4);
+    file.read((char*) &version, sizeof(version));
+    file.read((char*) &fileHash, sizeof(fileHash));
+    file.read((char*) &glyphSize, sizeof(glyphSize));
+    file.read((char*) &count, sizeof(count));
+
+    if(!file || std::memcmp(magic, SEAG_FONT_CACHE_MAGIC, 4) != 0 || version != SEAG_FONT_CACHE_VERSION || fileHash != hash || glyphSize != m_glyph_size)
+        return false;
+
+    glyphs.resize(count);
+    file.read((char*) glyphs.data(), count * sizeof(impl::Glyph));
+
+    if(!file)
+    {
+        glyphs.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void seag::Font::saveMetrics(const std::string& cache_path, uint64_t hash, const std::vector<impl::Glyph>& glyphs)
+{
+    std::ofstream file(cache_path, std::ios::binary | std::ios::trunc);
+    if(!file)
+    {
+        SEAG_ERROR_LOG("Failed to write font cache " + cache_path);
+        return;
+    }
+
+    uint32_t version = SEAG_FONT_CACHE_VERSION;
+    uint32_t count = glyphs.size();
+    int32_t glyphSize = m_glyph_size;
+
+    file.write(SEAG_FONT_CACHE_MAGIC, 4);
+    file.write((const char*) &version, sizeof(version));
+    file.write((const char*) &hash, sizeof(hash));
+    file.write((const char*) &glyphSize, sizeof(glyphSize));
+    file.write((const char*) &count, sizeof(count));
+    file.write((const char*) glyphs.data(), count * sizeof(impl::Glyph));
+}
+
+bool seag::impl::findPixels(const uint8_t* pixels, int count, int& first, int& last)
+{
+    //A pixel is empty when it is opaque black or fully transparent.
+    first = -1;
+    last = -1;
+    int x = 0;
+
+#ifdef __SSE2__
+    const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; x + 4 <= count; x += 4)
+    {
+        __m128i color = _mm_loadu_si128((const __m128i*) (pixels + x * 4));
+        __m128i black = _mm_cmpeq_epi32(color, alphaMask);
+        __m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(color, alphaMask), zero);
+        int mask = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(black, transparent))) & 0xF;
+
+        if(mask == 0)
+            continue;
+
+        if(first == -1)
+            first = x + __builtin_ctz(mask);
+        last = x + 31 - __builtin_clz(mask);
+    }
+#endif
+
+    for(; x < count; x++)
+    {
+        const uint8_t* pixel = pixels + x * 4;
+        if(pixel[3] == 0 || (pixel[0] == 0 && pixel[1] == 0 && pixel[2] == 0 && pixel[3] == 255))
+            continue;
+
+        if(first == -1)
+            first = x;
+        last = x;
+    }
+
+    return first != -1;
+}
+
+bool seag::impl::isTrueType(const uint8_t* data, size_t size)
+{
+    if(data == nullptr || size < 4)
+        return false;
+
+    //TrueType (1.0 or 'true'), OpenType with CFF outlines ('OTTO') and collections ('ttcf').
+    return std::memcmp(data, "\x00\x01\x00\x00", 4) == 0 || std::memcmp(data, "true", 4) == 0
+        || std::memcmp(data, "OTTO", 4) == 0 || std::memcmp(data, "ttcf", 4) == 0;
+}
+
+seag::impl::MappedFile::MappedFile()
+    : m_data(nullptr),
+    m_size(0),
+    m_mapped(false)
+{
+}
+
+seag::impl::MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool seag::impl::MappedFile::open(const std::string& path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER size;
+        if(GetFileSizeEx(file, &size) && size.QuadPart > 0)
+        {
+            //The view keeps the mapping alive, both handles can be closed.
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if(mapping != nullptr)
+            {
+                m_data = (const uint8_t*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                m_size = (size_t) size.QuadPart;
+                m_mapped = m_data != nullptr;
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+    }
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if(file != -1)
+    {
+        struct stat status;
+        if(fstat(file, &status) == 0 && status.st_size > 0)
+        {
+            void* data = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+            if(data != MAP_FAILED)
+            {
+                m_data = (const uint8_t*) data;
+                m_size = status.st_size;
+                m_mapped = true;
+            }
+        }
+        ::close(file);
+    }
+#endif
+
+    if(m_mapped)
+        return true;
+
+    //Files which cannot be mapped (empty, pipes...) are read.
+    m_size = 0;
+    std::ifstream stream(path, std::ios::binary);
+    if(!stream)
+        return false;
+
+    m_buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+}
+
+void seag::impl::MappedFile::close()
+{
+    if(m_mapped)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap((void*) m_data, m_size);
+#endif
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+}
+
+const uint8_t* seag::impl::MappedFile::getData() const
+{
+    return m_data;
+}
+
+size_t seag::impl::MappedFile::getSize() const
+{
+    return m_size;
+}
+
+seag::impl::Registry& seag::impl::Registry::get()
+{
+    static Registry registry;
+    return registry;
+}
+
+std::shared_ptr<seag::Font> seag::impl::Registry::getFont(const std::string& key, const std::function<Font*()>& load)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::weak_ptr<Font>& entry = m_fonts[key];
+    std::shared_ptr<Font> font = entry.lock();
+    if(font)
+        return font;
+
+    //Entries of fonts no longer used are dropped when another font is loaded.
+    for(auto it = m_fonts.begin(); it != m_fonts.end();)
+    {
+        if(it->second.expired() && it->first != key)
+            it = m_fonts.erase(it);
+        else
+            ++it;
+    }
+
+    font.reset(load());
+    m_fonts[key] = font;
+    return font;
+}
+
+std::shared_ptr<sf::Shader> seag::impl::Registry::getShader(const std::string& vertex, const std::string& fragment)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    //Sources are short, they are the key.
+    std::string key = vertex + '\0' + fragment;
+    std::shared_ptr<sf::Shader> shader = m_shaders[key].lock();
+    if(shader)
+        return shader;
+
+    shader.reset(new sf::Shader());
+    if(!shader->loadFromMemory(vertex, fragment))
+    {
+        m_shaders.erase(key);
+        return nullptr;
+    }
+
+    m_shaders[key] = shader;
+    return shader;
+}
+
+size_t seag::impl::Registry::getFontCount()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t count = 0;
+    for(auto& entry : m_fonts)
+        count += !entry.second.expired();
+    return count;
+}
+
+uint64_t seag::impl::hashPixels(const uint8_t* pixels, size_t size)
+{
+    //FNV-1a on 64 bits words (then remaining bytes).
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    size_t i = 0;
+
+    for(; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, pixels + i, 8);
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+
+    for(; i < size; i++)
+        hash = (hash ^ pixels[i]) * 0x100000001b3ULL;
+
+    return hash;
+}
+
+void seag::impl::writeVarint(std::vector<uint8_t>& data, uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        data.push_back((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    data.push_back(value);
+}
+
+uint8_t seag::impl::ByteReader::readByte()
+{
+    if(offset >= size)
+    {
+        failed = true;
+        return 0;
+    }
+
+    return data[offset++];
+}
+
+uint32_t seag::impl::ByteReader::readUint32()
+{
+    uint32_t value = 0;
+    for(int i = 0; i < 4; i++)
+        value |= (uint32_t) readByte() << (i * 8);
+    return value;
+}
+
+uint64_t seag::impl::ByteReader::readVarint()
+{
+    uint64_t value = 0;
+
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t byte = readByte();
+        value |= (uint64_t) (byte & 0x7F) << shift;
+        if(!(byte & 0x80))
+            return value;
+    }
+
+    failed = true;
+    return 0;
+}
+
+void seag::impl::compressLz(const uint8_t* data, size_t size, std::vector<uint8_t>& compressed)
+{
+    //Each sequence is a token (literal count and match length - 4, 15 means more length bytes follow), the literals, then the match offset.
+    compressed.clear();
+    compressed.reserve(size / 2 + 16);
+
+    auto writeLength = [&compressed](size_t length) {
+        for(; length >= 255; length -= 255)
+            compressed.push_back(255);
+        compressed.push_back(length);
+    };
+
+    //Last position + 1 of each hashed 4 bytes sequence.
+    std::vector<uint32_t> table(1 << 14, 0);
+    size_t anchor = 0;
+    size_t i = 0;
+
+    while(i + 4 <= size)
+    {
+        uint32_t sequence;
+        std::memcpy(&sequence, data + i, 4);
+        uint32_t hash = (sequence * 2654435761u) >> 18;
+        size_t candidate = table[hash];
+        table[hash] = i + 1;
+
+        if(candidate == 0 || i - (candidate - 1) > 65535 || std::memcmp(data + candidate - 1, data + i, 4) != 0)
+        {
+            i++;
+            continue;
+        }
+
+        size_t match = candidate - 1;
+        size_t length = 4;
+        while(i + length < size && data[match + length] == data[i + length])
+            length++;
+
+        size_t literals = i - anchor;
+        compressed.push_back((std::min<size_t>(literals, 15) << 4) | std::min<size_t>(length - 4, 15));
+        if(literals >= 15)
+            writeLength(literals - 15);
+        compressed.insert(compressed.end(), data + anchor, data + i);
+
+        size_t offset = i - match;
+        compressed.push_back(offset & 0xFF);
+        compressed.push_back(offset >> 8);
+        if(length - 4 >= 15)
+            writeLength(length - 4 - 15);
+
+        i += length;
+        anchor = i;
+    }
+
+    //The last sequence only has literals.
+    size_t literals = size - anchor;
+    compressed.push_back(std::min<size_t>(literals, 15) << 4);
+    if(literals >= 15)
+        writeLength(literals - 15);
+    compressed.insert(compressed.end(), data + anchor, data + size);
+}
+
+bool seag::impl::decompressLz(const uint8_t* data, size_t size, size_t decompressedSize, std::vector<uint8_t>& decompressed)
+{
+    decompressed.clear();
+    decompressed.reserve(decompressedSize);
+    size_t i = 0;
+
+    auto readLength = [&](size_t& length) {
+        uint8_t byte;
+        do
+        {
+            if(i >= size)
+                return false;
+            byte = data[i++];
+            length += byte;
+        } while(byte == 255);
+        return true;
+    };
+
+    while(i < size)
+    {
+        uint8_t token = data[i++];
+
+        size_t literals = token >> 4;
+        if(literals == 15 && !readLength(literals))
+            return false;
+        if(literals > size - i || decompressed.size() + literals > decompressedSize)
+            return false;
+
+        decompressed.insert(decompressed.end(), data + i, data + i + literals);
+        i += literals;
+
+        //The last sequence has no match.
+        if(i == size)
+            break;
+        if(size - i < 2)
+            return false;
+
+        size_t offset = data[i] | data[i + 1] << 8;
+        i += 2;
+
+        size_t length = token & 15;
+        if(length == 15 && !readLength(length))
+            return false;
+        length += 4;
+
+        if(offset == 0 || offset > decompressed.size() || decompressed.size() + length > decompressedSize)
+            return false;
+
+        //Matches can overlap the bytes they write (repeated patterns), so they are copied byte by byte.
+        size_t position = decompressed.size();
+        decompressed.resize(position + length);
+        for(size_t k = 0; k < length; k++)
+            decompressed[position + k] = decompressed[position - offset + k];
+    }
+
+    return decompressed.size() == decompressedSize;
+}
+
+const char* seag::impl::decodeUtf8(const char* str, const char* end, char32_t& character)
+{
+    const unsigned char* c = (const unsigned char*) str;
+    character = 0xFFFD;
+
+    if(c[0] < 0x80)
+    {
+        character = c[0];
+        return str + 1;
+    }
+
+    //Determine the length of the sequence and the smallest character it may encode (to reject overlong forms).
+    int length;
+    char32_t minimum;
+
+    if((c[0] & 0xE0) == 0xC0)
+    {
+        length = 2;
+        minimum = 0x80;
+        character = c[0] & 0x1F;
+    }
+    else if((c[0] & 0xF0) == 0xE0)
+    {
+        length = 3;
+        minimum = 0x800;
+        character = c[0] & 0x0F;
+    }
+    else if((c[0] & 0xF8) == 0xF0)
+    {
+        length = 4;
+        minimum = 0x10000;
+        character = c[0] & 0x07;
+    }
+    else
+    {
+        character = 0xFFFD;
+        return str + 1;
+    }
+
+    if(end - str < length)
+    {
+        character = 0xFFFD;
+        return str + 1;
+    }
+
+    for(int i = 1; i < length; i++)
+    {
+        if((c[i] & 0xC0) != 0x80)
+        {
+            character = 0xFFFD;
+            return str + 1;
+        }
+
+        character = (character << 6) | (c[i] & 0x3F);
+    }
+
+    if(character < minimum || character > 0x10FFFF || (character >= 0xD800 && character <= 0xDFFF))
+    {
+        character = 0xFFFD;
+        return str + 1;
+    }
+
+    return str + length;
+}
+
+void seag::impl::encodeUtf8(std::string& str, char32_t character)
+{
+    //Surrogates and values past the last code point are not characters.
+    if((character >= 0xD800 && character <= 0xDFFF) || character > 0x10FFFF)
+        character = 0xFFFD;
+
+    if(character < 0x80)
+        str.push_back(character);
+    else if(character < 0x800)
+    {
+        str.push_back(0xC0 | (character >> 6));
+        str.push_back(0x80 | (character & 0x3F));
+    }
+    else if(character < 0x10000)
+    {
+        str.push_back(0xE0 | (character >> 12));
+        str.push_back(0x80 | ((character >> 6) & 0x3F));
+        str.push_back(0x80 | (character & 0x3F));
+    }
+    else
+    {
+        str.push_back(0xF0 | (character >> 18));
+        str.push_back(0x80 | ((character >> 12) & 0x3F));
+        str.push_back(0x80 | ((character >> 6) & 0x3F));
+        str.push_back(0x80 | (character & 0x3F));
+    }
+}
+
+bool seag::impl::isWideCharacter(char32_t character)
+{
+    //East Asian wide and fullwidth blocks, and the emoji blocks most terminals draw on two columns.
+    return (character >= 0x1100 && character <= 0x115F)
+        || (character >= 0x2E80 && character <= 0xA4CF && character != 0x303F)
+        || (character >= 0xAC00 && character <= 0xD7A3)
+        || (character >= 0xF900 && character <= 0xFAFF)
+        || (character >= 0xFE30 && character <= 0xFE4F)
+        || (character >= 0xFF00 && character <= 0xFF60)
+        || (character >= 0xFFE0 && character <= 0xFFE6)
+        || (character >= 0x1F300 && character <= 0x1F64F)
+        || (character >= 0x1F900 && character <= 0x1F9FF)
+        || (character >= 0x20000 && character <= 0x3FFFD);
+}
+
+size_t seag::impl::countPrintableAscii(const char* str, const char* end)
+{
+    const char* c = str;
+
+#ifdef __SSE2__
+    //Bytes are compared as signed: control characters and non-ASCII bytes are both below 0x20.
+    const __m128i limit = _mm_set1_epi8(0x1F);
+
+    for(; end - c >= 16; c += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) c);
+        int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, limit));
+
+        if(mask != 0xFFFF)
+            return (c - str) + __builtin_ctz(~mask);
+    }
+#endif
+
+    while(c < end && (signed char) *c > 0x1F)
+        c++;
+
+    return c - str;
+}
+
+void seag::impl::appendCharacters(std::u32string& str, const char32_t* begin, const char32_t* end)
+{
+    str.append(begin, end);
+}
+
+void seag::impl::appendCharacters(std::u32string& str, const char* begin, const char* end)
+{
+    while(begin < end)
+    {
+        char32_t character;
+        begin = decodeUtf8(begin, end, character);
+        str += character;
+    }
+}
+
+void seag::impl::combineStyle(StyleChange& change, const StyleChange& next)
+{
+    //A reset discards the previous changes.
+    if(next.flags & StyleChange::Reset)
+    {
+        change = next;
+        return;
+    }
+
+    change.flags ^= next.flags & (StyleChange::ToggleBold | StyleChange::ToggleItalic);
+
+    if(next.flags & StyleChange::Foreground)
+    {
+        change.flags |= StyleChange::Foreground;
+        change.foregroundColor = next.foregroundColor;
+    }
+
+    if(next.flags & StyleChange::Background)
+    {
+        change.flags |= StyleChange::Background;
+        change.backgroundColor = next.backgroundColor;
+    }
+}
+
+template<typename CharT>
+bool seag::impl::parseHexColor(const CharT* digits, sf::Color& color)
+{
+    uint32_t value = 0;
+
+    for(int i = 0; i < 6; i++)
+    {
+        char32_t c = digits[i];
+        uint32_t digit;
+
+        if(c >= '0' && c <= '9')
+            digit = c - '0';
+        else if(c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if(c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            return false;
+
+        value = (value << 4) | digit;
+    }
+
+    color = sf::Color((value << 8) | 0xFF);
+    return true;
+}
+
+template<typename CharT, typename Handler>
+void seag::impl::parseMarkup(const CharT* str, size_t length, Handler& handler)
+{
+    size_t textBegin = 0;
+    size_t i = 0;
+
+    while(i < length)
+    {
+        if(str[i] == SEAG_STYLE_ESCAPE)
+        {
+            //The escaped character starts the next text (it is never read as a tag).
+            if(i > textBegin)
+                handler.text(str + textBegin, str + i);
+            textBegin = i + 1;
+            i += 2;
+            continue;
+        }
+
+        if(str[i] != SEAG_STYLE || i + 1 >= length)
+        {
+            i++;
+            continue;
+        }
+
+        StyleChange change = { 0, sf::Color(), sf::Color() };
+        size_t tagLength = 2;
+        CharT tag = str[i+1];
+
+        if(tag == SEAG_STYLE_RESET)
+            change.flags = StyleChange::Reset;
+        else if(tag == SEAG_STYLE_BOLD)
+            change.flags = StyleChange::ToggleBold;
+        else if(tag == SEAG_STYLE_ITALIC)
+            change.flags = StyleChange::ToggleItalic;
+        else if(tag == SEAG_STYLE_BACKGROUND && length - i >= 8 && parseHexColor(str + i + 2, change.backgroundColor))
+        {
+            change.flags = StyleChange::Background;
+            tagLength = 8;
+        }
+        else if(length - i >= 7 && parseHexColor(str + i + 1, change.foregroundColor))
+        {
+            change.flags = StyleChange::Foreground;
+            tagLength = 7;
+        }
+        else
+        {
+            //Not a tag, the style character is printed.
+            i++;
+            continue;
+        }
+
+        if(i > textBegin)
+            handler.text(str + textBegin, str + i);
+        handler.style(change);
+
+        i += tagLength;
+        textBegin = i;
+    }
+
+    if(length > textBegin)
+        handler.text(str + textBegin, str + length);
+}
+
+seag::StyledText::StyledText()
+{
+}
+
+seag::StyledText::StyledText(std::u32string_view markup)
+{
+    parse(markup);
+}
+
+seag::StyledText::StyledText(std::string_view markup)
+{
+    parse(markup);
+}
+
+void seag::StyledText::parse(std::u32string_view markup)
+{
+    parseMarkup(markup.data(), markup.size());
+}
+
+void seag::StyledText::parse(std::string_view markup)
+{
+    parseMarkup(markup.data(), markup.size());
+}
+
+const std::u32string& seag::StyledText::getCharacters() const
+{
+    return m_characters;
+}
+
+const std::vector<seag::StyledText::Run>& seag::StyledText::getRuns() const
+{
+    return m_runs;
+}
+
+template<typename CharT>
+void seag::StyledText::parseMarkup(const CharT* str, size_t length)
+{
+    struct Handler
+    {
+        StyledText& styledText;
+
+        void text(const CharT* begin, const CharT* end)
+        {
+            impl::appendCharacters(styledText.m_characters, begin, end);
+
+            styledText.m_runs.back().length = styledText.m_characters.size() - styledText.m_runs.back().begin;
+        }
+
+        void style(const impl::StyleChange& change)
+        {
+            //Consecutive tags are merged into the change of the same run.
+            Run& run = styledText.m_runs.back();
+            if(run.length == 0)
+                impl::combineStyle(run.change, change);
+            else
+                styledText.m_runs.push_back({ change, (uint32_t) styledText.m_characters.size(), 0 });
+        }
+    } handler = { *this };
+
+    m_characters.clear();
+    m_runs.clear();
+    m_runs.push_back({ { 0, sf::Color(), sf::Color() }, 0, 0 });
+
+    impl::parseMarkup(str, length, handler);
+}
+
+seag::impl::GlyphTable::GlyphTable()
+{
+    clear();
+}
+
+void seag::impl::GlyphTable::insert(char32_t character, const Glyph& glyph)
+{
+    uint32_t* slot;
+
+    if(character < 256)
+    {
+        slot = &m_latin[character];
+    }
+    else
+    {
+        //Allocate the page of the character on first use.
+        uint32_t page = character >> 8;
+        if(page >= m_pageTable.size())
+            m_pageTable.resize(page + 1, 0);
+
+        if(m_pageTable[page] == 0)
+        {
+            m_pages.resize(m_pages.size() + 256, 0);
+            m_pageTable[page] = m_pages.size() / 256;
+        }
+
+        slot = &m_pages[(m_pageTable[page] - 1) * 256 + (character & 0xFF)];
+    }
+
+    if(*slot != 0)
+    {
+        m_glyphs[*slot - 1] = glyph;
+        return;
+    }
+
+    m_glyphs.push_back(glyph);
+    *slot = m_glyphs.size();
+}
+
+const seag::impl::Glyph* seag::impl::GlyphTable::find(char32_t character) const
+{
+    uint32_t index;
+
+    if(character < 256)
+    {
+        index = m_latin[character];
+    }
+    else
+    {
+        uint32_t page = character >> 8;
+        if(page >= m_pageTable.size() || m_pageTable[page] == 0)
+            return nullptr;
+
+        index = m_pages[(m_pageTable[page] - 1) * 256 + (character & 0xFF)];
+    }
+
+    return index != 0 ? &m_glyphs[index - 1] : nullptr;
+}
+
+void seag::impl::GlyphTable::clear()
+{
+    m_glyphs.clear();
+    m_pageTable.clear();
+    m_pages.clear();
+    std::fill(m_latin, m_latin + 256, 0);
+}
+
+const seag::impl::Glyph& seag::impl::GlyphTable::at(size_t index) const
+{
+    return m_glyphs[index];
+}
+
+size_t seag::impl::GlyphTable::getIndex(const Glyph* glyph) const
+{
+    return glyph - m_glyphs.data();
+}
+
+size_t seag::impl::GlyphTable::getCount() const
+{
+    return m_glyphs.size();
+}
+
+size_t seag::impl::GlyphTable::getMemoryUsage() const
+{
+    return sizeof(GlyphTable) + m_glyphs.capacity() * sizeof(Glyph) + m_pageTable.capacity() * sizeof(uint32_t) + m_pages.capacity() * sizeof(uint32_t);
+}
+
+bool seag::operator==(const Brush& a, const Brush& b)
+{
+    return a.foregroundColor == b.foregroundColor && a.backgroundColor == b.backgroundColor && a.bold == b.bold && a.italic == b.italic;
+}
+
+bool seag::operator!=(const Brush& a, const Brush& b)
+{
+    return !(a == b);
+}
+
+void seag::impl::appendQuad(sf::VertexArray& vertices, const sf::FloatRect& quad, sf::Color color, const sf::FloatRect& textureRect)
+{
+    float left = quad.left, right = quad.left + quad.width;
+    float top = quad.top, bottom = quad.top + quad.height;
+
+    float texLeft = textureRect.left, texRight = textureRect.left + textureRect.width;
+    float texTop = textureRect.top, texBottom = textureRect.top + textureRect.height;
+
+    sf::Vertex topLeft({ left, top }, color, { texLeft, texTop });
+    sf::Vertex topRight({ right, top }, color, { texRight, texTop });
+    sf::Vertex bottomLeft({ left, bottom }, color, { texLeft, texBottom });
+    sf::Vertex bottomRight({ right, bottom }, color, { texRight, texBottom });
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+bool seag::impl::clipCopy(sf::IntRect& source, sf::Vector2i& destination, sf::Vector2u sourceSize, sf::Vector2u destinationSize)
+{
+    int64_t sourceX = source.left, sourceY = source.top;
+    int64_t destinationX = destination.x, destinationY = destination.y;
+    int64_t columns = source.width, rows = source.height;
+
+    //Cut what is before the top left corner of either grid (from both rectangles).
+    int64_t cutX = std::max<int64_t>({ 0, -sourceX, -destinationX });
+    int64_t cutY = std::max<int64_t>({ 0, -sourceY, -destinationY });
+    sourceX += cutX, destinationX += cutX, columns -= cutX;
+    sourceY += cutY, destinationY += cutY, rows -= cutY;
+
+    columns = std::min({ columns, (int64_t) sourceSize.x - sourceX, (int64_t) destinationSize.x - destinationX });
+    rows = std::min({ rows, (int64_t) sourceSize.y - sourceY, (int64_t) destinationSize.y - destinationY });
+    if(columns <= 0 || rows <= 0)
+        return false;
+
+    source = sf::IntRect(sourceX, sourceY, columns, rows);
+    destination = sf::Vector2i(destinationX, destinationY);
+    return true;
+}
+
+bool seag::impl::isSameView(const sf::View& a, const sf::View& b)
+{
+    return a.getCenter() == b.getCenter() && a.getSize() == b.getSize() && a.getRotation() == b.getRotation() && a.getViewport() == b.getViewport();
+}
+
+bool seag::impl::blitRow(BufferCharacter* destination, const BufferCharacter* source, uint32_t count)
+{
+    bool changed = false;
+    uint32_t x = 0;
+
+#ifdef __SSE2__
+    static_assert(sizeof(BufferCharacter) == 8, "two characters per SSE2 register");
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; x + 2 <= count; x += 2)
+    {
+        __m128i cells = _mm_loadu_si128((const __m128i*) (source + x));
+        __m128i previous = _mm_loadu_si128((const __m128i*) (destination + x));
+
+        //Spread the empty test of each code over its whole character (code, brush and padding).
+        __m128i empty = _mm_shuffle_epi32(_mm_cmpeq_epi32(cells, zero), _MM_SHUFFLE(2, 2, 0, 0));
+        __m128i result = _mm_or_si128(_mm_and_si128(empty, previous), _mm_andnot_si128(empty, cells));
+
+        //Padding bytes (6, 7, 14 and 15) are not compared.
+        changed |= (_mm_movemask_epi8(_mm_cmpeq_epi8(result, previous)) & 0x3F3F) != 0x3F3F;
+        _mm_storeu_si128((__m128i*) (destination + x), result);
+    }
+#endif
+
+    for(; x < count; x++)
+    {
+        const BufferCharacter& cell = source[x];
+        if(cell.code == 0 || (destination[x].code == cell.code && destination[x].brush == cell.brush))
+            continue;
+
+        destination[x] = cell;
+        changed = true;
+    }
+
+    return changed;
+}
+
+uint64_t seag::impl::getChunkKey(int32_t x, int32_t y)
+{
+    return ((uint64_t) (uint32_t) x << 32) | (uint32_t) y;
+}
+
+int64_t seag::impl::floorDivide(int64_t value, int64_t divisor)
+{
+    return value / divisor - (value % divisor != 0 && (value < 0) != (divisor < 0));
+}
+
+seag::impl::BufferCharacter* seag::impl::ScreenBufferView::getRow(uint32_t y) const
+{
+    size_t row = (size_t) first + y;
+    if(ring > 0 && row >= ring)
+        row -= ring;
+
+    return cells + row * stride;
+}
+
+seag::impl::ScreenBuffer::ScreenBuffer()
+    : ScreenBuffer(0, 0)
+{
+}
+
+seag::impl::ScreenBuffer::ScreenBuffer(uint32_t columns, uint32_t rows)
+    : m_cells((size_t) columns * rows, BufferCharacter{ 0, 0 }),
+    m_drawnCells((size_t) columns * rows, BufferCharacter{ 0, 0 }),
+    m_dirtyRows(rows, RowForced),
+    m_columns(columns),
+    m_rows(rows),
+    m_scrollback(0),
+    m_scrollbackSize(0),
+    m_first(0),
+    m_viewOffset(0),
+    m_scrolled(0)
+{
+}
+
+uint32_t seag::impl::ScreenBuffer::getColumns() const
+{
+    return m_columns;
+}
+
+uint32_t seag::impl::ScreenBuffer::getRows() const
+{
+    return m_rows;
+}
+
+bool seag::impl::ScreenBuffer::contains(int64_t x, int64_t y) const
+{
+    return x >= 0 && y >= 0 && x < m_columns && y < m_rows;
+}
+
+seag::impl::BufferCharacter& seag::impl::ScreenBuffer::at(uint32_t x, uint32_t y)
+{
+    return getRow(y)[x];
+}
+
+const seag::impl::BufferCharacter& seag::impl::ScreenBuffer::at(uint32_t x, uint32_t y) const
+{
+    return getRow(y)[x];
+}
+
+seag::impl::BufferCharacter* seag::impl::ScreenBuffer::getRow(uint32_t y)
+{
+    return m_cells.data() + getRingIndex((int64_t) y - m_viewOffset) * m_columns;
+}
+
+const seag::impl::BufferCharacter* seag::impl::ScreenBuffer::getRow(uint32_t y) const
+{
+    return m_cells.data() + getRingIndex((int64_t) y - m_viewOffset) * m_columns;
+}
+
+const seag::impl::BufferCharacter* seag::impl::ScreenBuffer::getAbsoluteRow(uint64_t row) const
+{
+    int64_t y = (int64_t) row - (int64_t) m_scrolled;
+    if(y < -(int64_t) m_scrollbackSize || y >= m_rows)
+        return nullptr;
+
+    return m_cells.data() + getRingIndex(y) * m_columns;
+}
+
+void seag::impl::ScreenBuffer::set(int64_t x, int64_t y, const BufferCharacter& character)
+{
+    if(!contains(x, y))
+        return;
+
+    BufferCharacter& cell = getRow(y)[x];
+    if(cell.code == character.code && cell.brush == character.brush)
+        return;
+
+    cell = character;
+    m_dirtyRows[y] |= RowChanged;
+}
+
+seag::impl::ScreenBufferView seag::impl::ScreenBuffer::getView()
+{
+    return getView(0, 0, m_columns, m_rows);
+}
+
+seag::impl::ScreenBufferView seag::impl::ScreenBuffer::getView(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+{
+    //Clip the rectangle to the grid.
+    x = std::min(x, m_columns);
+    y = std::min(y, m_rows);
+    columns = std::min(columns, m_columns - x);
+    rows = std::min(rows, m_rows - y);
+
+    //The view starts at the ring row of its first row and wraps like the ring.
+    uint32_t first = rows > 0 ? (uint32_t) getRingIndex((int64_t) y - m_viewOffset) : 0;
+    return { m_cells.data() + x, columns, rows, m_columns, nullptr, first, m_rows + m_scrollback };
+}
+
+void seag::impl::ScreenBuffer::copy(const ScreenBufferView& view, uint32_t x, uint32_t y)
+{
+    if(x >= m_columns || y >= m_rows)
+        return;
+
+    uint32_t columns = std::min(view.columns, m_columns - x);
+    uint32_t rows = std::min(view.rows, m_rows - y);
+    size_t size = columns * sizeof(BufferCharacter);
+
+    //Rows may overlap when the view comes from this buffer, so move instead of copy (from the last row when moving down).
+    bool backwards = false;
+    if(view.ring > 0 && view.ring == m_rows + m_scrollback && !std::less<const BufferCharacter*>()(view.cells, m_cells.data()) && std::less<const BufferCharacter*>()(view.cells, m_cells.data() + m_columns))
+    {
+        uint32_t top = (uint32_t) getRingIndex(-(int64_t) m_viewOffset);
+        backwards = (view.first + view.ring - top) % view.ring < y;
+    }
+
+    for(uint32_t i = 0; i < rows; i++)
+    {
+        uint32_t ly = backwards ? rows - 1 - i : i;
+        BufferCharacter* row = getRow(y + ly) + x;
+        const BufferCharacter* source = view.getRow(ly);
+
+        if(std::memcmp(row, source, size) == 0)
+            continue;
+
+        std::memmove(row, source, size);
+        m_dirtyRows[y + ly] |= RowChanged;
+    }
+}
+
+void seag::impl::ScreenBuffer::blit(const ScreenBufferView& view, uint32_t x, uint32_t y)
+{
+    if(x >= m_columns || y >= m_rows)
+        return;
+
+    uint32_t columns = std::min(view.columns, m_columns - x);
+    uint32_t rows = std::min(view.rows, m_rows - y);
+
+    for(uint32_t ly = 0; ly < rows; ly++)
+    {
+        if(blitRow(getRow(y + ly) + x, view.getRow(ly), columns))
+            m_dirtyRows[y + ly] |= RowChanged;
+    }
+}
+
+void seag::impl::ScreenBuffer::fill(const sf::IntRect& rect, const BufferCharacter& character)
+{
+    sf::IntRect area = rect;
+    sf::Vector2i position(rect.left, rect.top);
+    if(!clipCopy(area, position, { m_columns, m_rows }, { m_columns, m_rows }))
+        return;
+
+    //Rows which already hold the character are not marked dirty (panels filled again each frame in retained mode).
+    for(int y = area.top; y < area.top + area.height; y++)
+    {
+        BufferCharacter* begin = getRow(y) + area.left;
+        BufferCharacter* end = begin + area.width;
+        BufferCharacter* first = std::find_if(begin, end, [&character](const BufferCharacter& cell) {
+            return cell.code != character.code || cell.brush != character.brush;
+        });
+
+        if(first == end)
+            continue;
+
+        std::fill(first, end, character);
+        m_dirtyRows[y] |= RowChanged;
+    }
+}
+
+void seag::impl::ScreenBuffer::resize(uint32_t columns, uint32_t rows)
+{
+    if(columns == m_columns && rows == m_rows)
+        return;
+
+    //Copy the characters that still fit into a new ring (the scrollback is kept).
+    std::vector<BufferCharacter> cells;
+    reorder(cells, columns, rows, m_scrollback);
+
+    m_cells.swap(cells);
+    m_columns = columns;
+    m_rows = rows;
+    m_first = m_scrollbackSize;
+    m_drawnCells.assign((size_t) columns * rows, BufferCharacter{ 0, 0 });
+    m_dirtyRows.assign(rows, RowForced);
+}
+
+void seag::impl::ScreenBuffer::clear()
+{
+    //Only rows which had characters need to be drawn again.
+    for(uint32_t y = 0; y < m_rows; y++)
+    {
+        BufferCharacter* row = getRow(y);
+
+        for(uint32_t x = 0; x < m_columns; x++)
+        {
+            if(row[x].code == 0)
+                continue;
+
+            std::fill(row, row + m_columns, BufferCharacter{ 0, 0 });
+            m_dirtyRows[y] |= RowChanged;
+            break;
+        }
+    }
+}
+
+uint32_t seag::impl::ScreenBuffer::getScrollback() const
+{
+    return m_scrollback;
+}
+
+void seag::impl::ScreenBuffer::setScrollback(uint32_t rows)
+{
+    if(rows == m_scrollback)
+        return;
+
+    std::vector<BufferCharacter> cells;
+    reorder(cells, m_columns, m_rows, rows);
+
+    m_cells.swap(cells);
+    m_scrollback = rows;
+    m_scrollbackSize = std::min(m_scrollbackSize, rows);
+    m_first = m_scrollbackSize;
+    m_viewOffset = std::min(m_viewOffset, m_scrollbackSize);
+    markDirty();
+}
+
+uint32_t seag::impl::ScreenBuffer::getScrollbackSize() const
+{
+    return m_scrollbackSize;
+}
+
+uint64_t seag::impl::ScreenBuffer::getFirstRow() const
+{
+    return m_scrolled;
+}
+
+void seag::impl::ScreenBuffer::scroll(uint32_t rows)
+{
+    if(rows == 0)
+        return;
+
+    //The first row of the screen moves forward in the ring, the slot of the new last row (oldest scrollback row when full) is cleared.
+    uint32_t capacity = m_rows + m_scrollback;
+    uint32_t cleared = std::min(rows, capacity);
+    for(uint32_t i = 0; i < cleared && m_rows > 0; i++)
+    {
+        m_first = (m_first + 1) % capacity;
+        BufferCharacter* row = m_cells.data() + getRingIndex(m_rows - 1) * m_columns;
+        std::fill(row, row + m_columns, BufferCharacter{ 0, 0 });
+    }
+
+    m_scrollbackSize = std::min<uint64_t>((uint64_t) m_scrollbackSize + rows, m_scrollback);
+    m_viewOffset = std::min(m_viewOffset, m_scrollbackSize);
+    m_scrolled += rows;
+    markDirty();
+}
+
+uint32_t seag::impl::ScreenBuffer::getViewOffset() const
+{
+    return m_viewOffset;
+}
+
+void seag::impl::ScreenBuffer::setViewOffset(uint32_t offset)
+{
+    offset = std::min(offset, m_scrollbackSize);
+    if(offset == m_viewOffset)
+        return;
+
+    m_viewOffset = offset;
+    markDirty();
+}
+
+bool seag::impl::ScreenBuffer::isRowDirty(uint32_t y) const
+{
+    //Changed rows are compared with the drawn ones, so a row cleared and printed again the same way is not drawn again.
+    if(m_dirtyRows[y] == 0)
+        return false;
+    if(m_dirtyRows[y] & RowForced)
+        return true;
+
+    return std::memcmp(getRow(y), m_drawnCells.data() + (size_t) y * m_columns, m_columns * sizeof(BufferCharacter)) != 0;
+}
+
+bool seag::impl::ScreenBuffer::isDirty() const
+{
+    for(uint32_t y = 0; y < m_rows; y++)
+    {
+        if(isRowDirty(y))
+            return true;
+    }
+
+    return false;
+}
+
+void seag::impl::ScreenBuffer::markRowDirty(uint32_t y)
+{
+    if(y < m_rows)
+        m_dirtyRows[y] |= RowForced;
+}
+
+void seag::impl::ScreenBuffer::markDirty()
+{
+    std::fill(m_dirtyRows.begin(), m_dirtyRows.end(), RowForced);
+}
+
+void seag::impl::ScreenBuffer::clearDirty()
+{
+    //Rows which changed become the drawn rows.
+    for(uint32_t y = 0; y < m_rows; y++)
+    {
+        if(m_dirtyRows[y] != 0)
+            std::memcpy(m_drawnCells.data() + (size_t) y * m_columns, getRow(y), m_columns * sizeof(BufferCharacter));
+    }
+
+    std::fill(m_dirtyRows.begin(), m_dirtyRows.end(), 0);
+}
+
+void seag::impl::ScreenBuffer::copyDirtyRows(const ScreenBuffer& source)
+{
+    if(source.m_columns != m_columns || source.m_rows != m_rows || source.m_scrollback != m_scrollback || source.m_scrolled < m_scrolled)
+    {
+        *this = source;
+        return;
+    }
+
+    //Rows scrolled since the last copy are copied with the whole screen, after the ring of this buffer is rotated the same way.
+    uint64_t scrolled = source.m_scrolled - m_scrolled;
+    if(scrolled > 0 || source.m_viewOffset != m_viewOffset)
+    {
+        scroll(std::min<uint64_t>(scrolled, m_rows + m_scrollback));
+        m_scrolled = source.m_scrolled;
+        m_scrollbackSize = source.m_scrollbackSize;
+        m_viewOffset = source.m_viewOffset;
+
+        for(int64_t y = -(int64_t) std::min<uint64_t>(scrolled, m_scrollbackSize); y < m_rows; y++)
+            std::memcpy(m_cells.data() + getRingIndex(y) * m_columns, source.m_cells.data() + source.getRingIndex(y) * m_columns, m_columns * sizeof(BufferCharacter));
+
+        markDirty();
+        return;
+    }
+
+    for(uint32_t y = 0; y < m_rows; y++)
+    {
+        if(!source.m_dirtyRows[y])
+            continue;
+
+        std::memcpy(getRow(y), source.getRow(y), m_columns * sizeof(BufferCharacter));
+        m_dirtyRows[y] |= RowChanged;
+    }
+}
+
+void seag::impl::ScreenBuffer::markBrushes(std::vector<uint8_t>& used) const
+{
+    //Brushes of the drawn rows are kept so they are still told apart from new ones.
+    for(const BufferCharacter& cell : m_cells)
+        used[cell.brush] = 1;
+    for(const BufferCharacter& cell : m_drawnCells)
+        used[cell.brush] = 1;
+}
+
+void seag::impl::ScreenBuffer::remapBrushes(const std::vector<uint16_t>& remap)
+{
+    for(BufferCharacter& cell : m_cells)
+        cell.brush = remap[cell.brush];
+    for(BufferCharacter& cell : m_drawnCells)
+        cell.brush = remap[cell.brush];
+}
+
+size_t seag::impl::ScreenBuffer::getMemoryUsage() const
+{
+    return (m_cells.capacity() + m_drawnCells.capacity()) * sizeof(BufferCharacter) + m_dirtyRows.capacity();
+}
+
+size_t seag::impl::ScreenBuffer::getRingIndex(int64_t y) const
+{
+    int64_t capacity = m_rows + m_scrollback;
+    int64_t index = m_first + y;
+
+    if(index < 0)
+        index += capacity;
+    else if(index >= capacity)
+        index -= capacity;
+
+    return index;
+}
+
+void seag::impl::ScreenBuffer::reorder(std::vector<BufferCharacter>& cells, uint32_t columns, uint32_t rows, uint32_t scrollback) const
+{
+    //Scrollback rows are copied first, then the screen rows.
+    uint32_t keptScrollback = std::min(m_scrollbackSize, scrollback);
+    uint32_t keptColumns = std::min(columns, m_columns);
+    int64_t keptRows = std::min(rows, m_rows);
+
+    cells.assign((size_t) columns * (rows + scrollback), BufferCharacter{ 0, 0 });
+
+    for(int64_t y = -(int64_t) keptScrollback; y < keptRows; y++)
+    {
+        const BufferCharacter* row = m_cells.data() + getRingIndex(y) * m_columns;
+        std::copy(row, row + keptColumns, cells.begin() + (size_t) (y + keptScrollback) * columns);
+    }
+}
+
+size_t seag::impl::BrushHash::operator()(const Brush& brush) const
+{
+    uint64_t foreground = brush.foregroundColor.toInteger();
+    uint64_t background = brush.backgroundColor.toInteger();
+    uint64_t key = (foreground << 32 | background) ^ ((uint64_t) brush.bold << 1 | (uint64_t) brush.italic) * 0x9E3779B97F4A7C15ull;
+
+    //Mix the bits so colors that only differ in one channel do not collide.
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDull;
+    key ^= key >> 33;
+    return key;
+}
+
+seag::impl::BrushTable::BrushTable()
+    : m_count(0),
+    m_revision(0),
+    m_lastBrush(),
+    m_lastId(0)
+{
+    uint16_t id;
+    intern(Brush(), id);
+}
+
+bool seag::impl::BrushTable::intern(const Brush& brush, uint16_t& id)
+{
+    if(m_count > 0 && brush == m_lastBrush)
+    {
+        id = m_lastId;
+        return true;
+    }
+
+    auto it = m_ids.find(brush);
+    if(it == m_ids.end())
+    {
+        if(m_count == 65536)
+            return false;
+
+        //Chunks are allocated when needed and never moved.
+        std::unique_ptr<Brush[]>& chunk = m_chunks[m_count / SEAG_BRUSH_CHUNK_SIZE];
+        if(!chunk)
+            chunk.reset(new Brush[SEAG_BRUSH_CHUNK_SIZE]);
+
+        chunk[m_count % SEAG_BRUSH_CHUNK_SIZE] = brush;
+        it = m_ids.emplace(brush, m_count).first;
+        m_count++;
+    }
+
+    m_lastBrush = brush;
+    m_lastId = it->second;
+    id = it->second;
+    return true;
+}
+
+const seag::Brush& seag::impl::BrushTable::get(uint16_t id) const
+{
+    return m_chunks[id / SEAG_BRUSH_CHUNK_SIZE][id % SEAG_BRUSH_CHUNK_SIZE];
+}
+
+uint32_t seag::impl::BrushTable::getCount() const
+{
+    return m_count;
+}
+
+uint32_t seag::impl::BrushTable::getRevision() const
+{
+    return m_revision;
+}
+
+void seag::impl::BrushTable::compact(const std::vector<uint8_t>& used, std::vector<uint16_t>& remap)
+{
+    //Kept brushes are moved down in id order, the empty cell brush stays at id 0.
+    remap.assign(65536, 0);
+    m_ids.clear();
+    uint32_t count = 0;
+
+    for(uint32_t id = 0; id < m_count; id++)
+    {
+        if(id != 0 && !used[id])
+            continue;
+
+        const Brush& brush = get(id);
+        m_chunks[count / SEAG_BRUSH_CHUNK_SIZE][count % SEAG_BRUSH_CHUNK_SIZE] = brush;
+        m_ids.emplace(brush, count);
+        remap[id] = count;
+        count++;
+    }
+
+    m_count = count;
+    m_revision++;
+    m_lastBrush = Brush();
+    m_lastId = 0;
+}
+
+size_t seag::impl::BrushTable::getMemoryUsage() const
+{
+    size_t chunks = std::count_if(std::begin(m_chunks), std::end(m_chunks), [](const std::unique_ptr<Brush[]>& chunk) { return chunk != nullptr; });
+    return chunks * SEAG_BRUSH_CHUNK_SIZE * sizeof(Brush) + m_ids.size() * (sizeof(Brush) + sizeof(uint16_t) + 2 * sizeof(void*));
+}
+
+seag::impl::PrintQueue::PrintQueue()
+    : m_head(&m_stub),
+    m_tail(&m_stub)
+{
+    m_stub.next.store(nullptr, std::memory_order_relaxed);
+}
+
+seag::impl::PrintQueue::~PrintQueue()
+{
+    while(PrintCommand* command = pop())
+        delete command;
+}
+
+void seag::impl::PrintQueue::push(PrintCommand* command)
+{
+    //Producers only race on the head exchange, the link to the previous node is published after.
+    command->next.store(nullptr, std::memory_order_relaxed);
+    PrintCommand* previous = m_head.exchange(command, std::memory_order_acq_rel);
+    previous->next.store(command, std::memory_order_release);
+}
+
+seag::impl::PrintCommand* seag::impl::PrintQueue::pop()
+{
+    PrintCommand* tail = m_tail;
+    PrintCommand* next = tail->next.load(std::memory_order_acquire);
+
+    //Skip the stub node.
+    if(tail == &m_stub)
+    {
+        if(next == nullptr)
+            return nullptr;
+
+        m_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if(next != nullptr)
+    {
+        m_tail = next;
+        return tail;
+    }
+
+    //A producer exchanged the head but did not link its node yet.
+    if(tail != m_head.load(std::memory_order_acquire))
+        return nullptr;
+
+    //The last node is kept until another one follows it, so the stub is pushed behind it.
+    push(&m_stub);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if(next != nullptr)
+    {
+        m_tail = next;
+        return tail;
+    }
+
+    return nullptr;
+}
+
+seag::impl::GridRenderer::GridRenderer()
+    : m_gridSize(0, 0),
+    m_dirtyBegin(0),
+    m_dirtyEnd(0),
+    m_font(nullptr),
+    m_quad(sf::Triangles),
+    m_shaderFont(nullptr),
+    m_shaderPages(0),
+    m_fontRevision(0),
+    m_fontEvictions(0),
+    m_shaderLoaded(false),
+    m_cellSize(0, 0),
+    m_background(sf::Color::Transparent)
+{
+}
+
+void seag::impl::GridRenderer::build(const ScreenBuffer& buffer, FrameState& frame)
+{
+    sf::Vector2u gridSize = { buffer.getColumns(), buffer.getRows() };
+    uint32_t rowsDrawn = frame.stats.rowsDrawn, cellsDrawn = frame.stats.cellsDrawn;
+
+    //Glyph indices depend on the font, so all rows are encoded again when it changes (or when the slots of a dynamic font are reused).
+    uint64_t evictions = frame.font->getEvictionCount();
+    bool redraw = gridSize != m_gridSize || frame.font != m_font || evictions != m_fontEvictions;
+    if(redraw)
+    {
+        m_cells.assign((size_t) gridSize.x * gridSize.y * 12, 0);
+        m_gridSize = gridSize;
+        m_font = frame.font;
+    }
+
+    m_dirtyBegin = gridSize.y;
+    m_dirtyEnd = 0;
+
+    for(uint32_t y = 0; y < gridSize.y; y++)
+    {
+        if(!redraw && !buffer.isRowDirty(y))
+            continue;
+
+        m_dirtyBegin = std::min(m_dirtyBegin, y);
+        m_dirtyEnd = y + 1;
+        frame.stats.rowsDrawn++;
+
+        const BufferCharacter* row = buffer.getRow(y);
+        uint8_t* texel = m_cells.data() + (size_t) y * gridSize.x * 12;
+
+        for(uint32_t x = 0; x < gridSize.x; x++, texel += 12)
+        {
+            //Empty characters only show the frame background.
+            const BufferCharacter& character = row[x];
+            const Brush& brush = frame.brushes->get(character.brush);
+            uint32_t index = character.code == 0 ? 0 : frame.font->getGlyphIndex(character.code, brush.bold, brush.italic) + 1;
+
+            texel[0] = index & 0xFF;
+            texel[1] = (index >> 8) & 0xFF;
+            texel[2] = (index >> 16) & 0xFF;
+            texel[3] = 255;
+            texel[4] = brush.foregroundColor.r;
+            texel[5] = brush.foregroundColor.g;
+            texel[6] = brush.foregroundColor.b;
+            texel[7] = brush.foregroundColor.a;
+            texel[8] = brush.backgroundColor.r;
+            texel[9] = brush.backgroundColor.g;
+            texel[10] = brush.backgroundColor.b;
+            texel[11] = brush.backgroundColor.a;
+
+            if(character.code != 0)
+                frame.stats.cellsDrawn++;
+        }
+    }
+
+    //Changed rows can evict the glyph of an unchanged row, all rows are then encoded again (glyphs looked up after an eviction are rasterized again).
+    //The counts of the partial pass are dropped. Evictions during the full pass can still leave stale indices, they are encoded again next frame (every frame if the glyphs on screen do not fit in the font budget).
+    if(redraw)
+        m_fontEvictions = evictions;
+    else if(frame.font->getEvictionCount() != evictions)
+    {
+        frame.stats.rowsDrawn = rowsDrawn;
+        frame.stats.cellsDrawn = cellsDrawn;
+        build(buffer, frame);
+    }
+}
+
+void seag::impl::GridRenderer::draw(sf::RenderTarget& target, FrameState& frame)
+{
+    if(m_shaderFont != m_font.get() || m_fontRevision != m_font->getRevision())
+        loadFont(m_font.get(), frame.stats);
+
+    if(!m_shaderLoaded || m_gridSize.x == 0 || m_gridSize.y == 0)
+        return;
+
+    //The cells texture is recreated (and fully uploaded) when the grid size changes.
+    if(m_cellsTexture.getSize() != sf::Vector2u(m_gridSize.x * 3, m_gridSize.y))
+    {
+        if(!m_cellsTexture.create(m_gridSize.x * 3, m_gridSize.y))
+        {
+            SEAG_ERROR_LOG("Could not create the grid cells texture.");
+            return;
+        }
+        m_dirtyBegin = 0;
+        m_dirtyEnd = m_gridSize.y;
+
+        m_shader.setUniform("cells", m_cellsTexture);
+        m_shader.setUniform("gridSize", sf::Glsl::Vec2((float) m_gridSize.x, (float) m_gridSize.y));
+        frame.stats.uniformUpdates += 2;
+    }
+
+    //Changed rows are contiguous in the cells data, so they are uploaded in one update.
+    if(m_dirtyBegin < m_dirtyEnd)
+        m_cellsTexture.update(m_cells.data() + (size_t) m_dirtyBegin * m_gridSize.x * 12, m_gridSize.x * 3, m_dirtyEnd - m_dirtyBegin, 0, m_dirtyBegin);
+
+    sf::Vector2f cellSize = { (float) frame.fontSize, frame.fontSize * 2.f };
+    if(cellSize != m_cellSize)
+    {
+        m_cellSize = cellSize;
+        m_shader.setUniform("cellSize", sf::Glsl::Vec2(cellSize));
+        m_shader.setUniform("scale", (cellSize.x / (float) m_font->getGlyphSize())*2);
+        frame.stats.uniformUpdates += 2;
+    }
+
+    if(frame.background != m_background)
+    {
+        m_background = frame.background;
+        m_shader.setUniform("background", sf::Glsl::Vec4(frame.background));
+        frame.stats.uniformUpdates++;
+    }
+
+    //One quad covers the grid (partially visible cells included), texture coordinates are cell positions.
+    sf::Vector2f size = { m_gridSize.x * cellSize.x, m_gridSize.y * cellSize.y };
+    m_quad.clear();
+    m_quad.append(sf::Vertex({ 0, 0 }, { 0, 0 }));
+    m_quad.append(sf::Vertex({ size.x, 0 }, { (float) m_gridSize.x, 0 }));
+    m_quad.append(sf::Vertex({ 0, size.y }, { 0, (float) m_gridSize.y }));
+    m_quad.append(sf::Vertex({ 0, size.y }, { 0, (float) m_gridSize.y }));
+    m_quad.append(sf::Vertex({ size.x, 0 }, { (float) m_gridSize.x, 0 }));
+    m_quad.append(sf::Vertex({ size.x, size.y }, { (float) m_gridSize.x, (float) m_gridSize.y }));
+
+    target.draw(m_quad, sf::RenderStates(sf::BlendAlpha, sf::Transform::Identity, nullptr, &m_shader));
+    frame.stats.drawCalls++;
+}
+
+void seag::impl::GridRenderer::loadFont(Font* font, FrameStats& stats)
+{
+    //Glyphs added to a dynamic font only change the metrics, the shader is generated again if pages were added.
+    bool metricsOnly = m_shaderLoaded && font == m_shaderFont && font->getPageCount() == m_shaderPages;
+    m_shaderFont = font;
+    m_shaderPages = font->getPageCount();
+    m_fontRevision = font->getRevision();
+    m_shaderLoaded = false;
+
+    //Each glyph index has 3 texels: atlas position, size, then origin and page (16 bits values).
+    uint32_t count = font->getGlyphIndexCount();
+    uint32_t height = (count * 3 + SEAG_GRID_METRICS_WIDTH - 1) / SEAG_GRID_METRICS_WIDTH;
+    std::vector<uint8_t> metrics((size_t) SEAG_GRID_METRICS_WIDTH * height * 4, 0);
+
+    for(uint32_t i = 0; i < count; i++)
+    {
+        const Glyph& glyph = font->getGlyphAt(i);
+        uint16_t values[6] = {
+            (uint16_t) (glyph.coords.x + glyph.origin.x), (uint16_t) (glyph.coords.y + glyph.origin.y),
+            (uint16_t) glyph.size.x, (uint16_t) glyph.size.y,
+            (uint16_t) glyph.origin.y, (uint16_t) glyph.page
+        };
+
+        uint8_t* texel = metrics.data() + (size_t) i * 12;
+        for(int j = 0; j < 6; j++)
+        {
+            texel[j * 2] = values[j] & 0xFF;
+            texel[j * 2 + 1] = values[j] >> 8;
+        }
+    }
+
+    if(!m_metricsTexture.create(SEAG_GRID_METRICS_WIDTH, height))
+    {
+        SEAG_ERROR_LOG("Could not create the grid metrics texture.");
+        return;
+    }
+    m_metricsTexture.update(metrics.data());
+
+    if(metricsOnly)
+    {
+        m_shader.setUniform("metrics", m_metricsTexture);
+        m_shader.setUniform("metricsSize", sf::Glsl::Vec2((float) SEAG_GRID_METRICS_WIDTH, (float) height));
+        stats.uniformUpdates += 2;
+        m_shaderLoaded = true;
+        return;
+    }
+
+    //GLSL 1.10 cannot index an array of samplers with a variable, so the pages are selected by a generated function.
+    std::string pages;
+    std::string samplePage = "vec4 samplePage(float page, vec2 texel)" "{";
+    for(uint32_t page = 0; page < font->getPageCount(); page++)
+    {
+        std::string index = std::to_string(page);
+        pages += "uniform sampler2D page" + index + ";" + "uniform vec2 pageSize" + index + ";";
+        samplePage += "if(page < " + index + ".5) return texture2D(page" + index + ", texel / pageSize" + index + ");";
+    }
+    samplePage += "return vec4(0.0);" "}";
+
+    if(!m_shader.loadFromMemory(gridVertexShader, pages + samplePage + gridFragmentShader))
+    {
+        SEAG_ERROR_LOG("Could not load the grid shader.");
+        return;
+    }
+
+    m_shader.setUniform("metrics", m_metricsTexture);
+    m_shader.setUniform("metricsSize", sf::Glsl::Vec2((float) SEAG_GRID_METRICS_WIDTH, (float) height));
+    for(uint32_t page = 0; page < font->getPageCount(); page++)
+    {
+        sf::Vector2u pageSize = font->getImage(page).getSize();
+        m_shader.setUniform("page" + std::to_string(page), font->getTexture(page));
+        m_shader.setUniform("pageSize" + std::to_string(page), sf::Glsl::Vec2((float) pageSize.x, (float) pageSize.y));
+    }
+    stats.uniformUpdates += 2 + font->getPageCount() * 2;
+
+    //A new shader has no uniforms, the grid ones are set again.
+    m_cellsTexture = sf::Texture();
+    m_cellSize = { 0, 0 };
+    m_background = sf::Color::Transparent;
+    m_shaderLoaded = true;
+}
+
+seag::Console::Console()
+    : Console(0, 0)
+{
+}
+
+seag::Console::Console(uint32_t columns, uint32_t rows)
+    : m_cursor(0, 0),
+    m_screenBuffer(columns, rows),
+    m_default_brush({sf::Color::White, sf::Color::Black, false, false}),
+    m_active_brush(m_default_brush),
+    m_retained(false),
+    m_printCalls(0),
+    m_printTiming(false)
+{
+}
+
+seag::Console::~Console()
+{
+}
+
+uint32_t seag::Console::getColumns()
+{
+    return m_screenBuffer.getColumns();
+}
+
+uint32_t seag::Console::getRows()
+{
+    return m_screenBuffer.getRows();
+}
+
+void seag::Console::resize(uint32_t columns, uint32_t rows)
+{
+    m_screenBuffer.resize(columns, rows);
+}
+
+sf::Vector2f seag::Console::getCursor()
+{
+    return m_cursor;
+}
+
+void seag::Console::setCursor(sf::Vector2f cursor)
+{
+    m_cursor = cursor;
+}
+
+seag::impl::ScreenBufferView seag::Console::getScreenBuffer()
+{
+    impl::ScreenBufferView view = m_screenBuffer.getView();
+    view.brushes = &m_brushes;
+    return view;
+}
+
+void seag::Console::setScreenBuffer(const impl::ScreenBufferView& view)
+{
+    if(view.brushes == nullptr || view.brushes == &m_brushes)
+    {
+        m_screenBuffer.copy(view, 0, 0);
+        return;
+    }
+
+    //Brush ids of another console are interned again in this one (once per id).
+    std::vector<impl::BufferCharacter> cells((size_t) view.columns * view.rows);
+    std::unordered_map<uint16_t, uint16_t> ids;
+
+    //A full table is compacted while interning, which changes the ids already written, so the cells are filled again (the table then only holds brushes on screen).
+    for(int attempt = 0; attempt < 2; attempt++)
+    {
+        uint32_t revision = m_brushes.getRevision();
+        ids.clear();
+
+        for(uint32_t y = 0; y < view.rows; y++)
+        {
+            for(uint32_t x = 0; x < view.columns; x++)
+            {
+                const impl::BufferCharacter& cell = view.getRow(y)[x];
+                auto it = ids.find(cell.brush);
+                if(it == ids.end())
+                    it = ids.emplace(cell.brush, getBrushId(view.brushes->get(cell.brush))).first;
+
+                cells[(size_t) y * view.columns + x] = { cell.code, it->second };
+            }
+        }
+
+        if(m_brushes.getRevision() == revision)
+            break;
+    }
+
+    m_screenBuffer.copy({ cells.data(), view.columns, view.rows, view.columns, &m_brushes, 0, 0 }, 0, 0);
+}
+
+std::u32string seag::Console::getLine(uint64_t y)
+{
+    const impl::BufferCharacter* row = m_screenBuffer.getAbsoluteRow(y);
+    if(row == nullptr)
+        throw std::out_of_range("seag::Console::getLine");
+
+    std::u32string line = U"";
+    uint32_t x = 0;
+
+    //Skip empty characters before the text then read until the next empty one.
+    while(x < m_screenBuffer.getColumns() && row[x].code == 0)
+        x++;
+
+    for(; x < m_screenBuffer.getColumns(); x++)
+    {
+        if(row[x].code == 0)
+            break;
+
+        line += row[x].code;
+    }
+
+    return line;
+}
+
+std::u32string seag::Console::getText(uint64_t y)
+{
+    std::u32string text = U"";
+    uint32_t columns = m_screenBuffer.getColumns();
+
+    //Read lines until one of them does not reach the end of the row (text continues on the next row otherwise).
+    for(const impl::BufferCharacter* row; (row = m_screenBuffer.getAbsoluteRow(y)) != nullptr; y++)
+    {
+        std::u32string line = getLine(y);
+        text += line;
+
+        if(line.empty() || row[columns - 1].code == 0)
+            break;
+    }
+
+    return text;
+}
+
+seag::impl::ResolvedCharacter seag::Console::getCharacter(uint32_t x, uint32_t y)
+{
+    if(!m_screenBuffer.contains(x, y))
+        throw std::out_of_range("seag::Console::getCharacter");
+
+    const impl::BufferCharacter& character = m_screenBuffer.at(x, y);
+    return { character.code, m_brushes.get(character.brush) };
+}
+
+template<typename Function>
+void seag::Console::timePrint(Function&& function)
+{
+    //Reading the clock costs about as much as printing a few characters, so single cell prints are only timed when asked.
+    m_printCalls++;
+    if(!m_printTiming)
+    {
+        function();
+        return;
+    }
+
+    sf::Clock clock;
+    function();
+    m_printTime += clock.getElapsedTime();
+}
+
+void seag::Console::print(std::u32string_view str)
+{
+    timePrint([this, str]() { printMarkup(str.data(), str.size()); });
+}
+
+void seag::Console::print(std::u32string_view str, uint32_t y)
+{
+    print(str, 0, y);
+}
+
+void seag::Console::print(std::u32string_view str, uint32_t x, uint32_t y)
+{
+    m_cursor = { (float) x, (float) y };
+    print(str);
+}
+
+void seag::Console::print(std::string_view str)
+{
+    timePrint([this, str]() { printMarkup(str.data(), str.size()); });
+}
+
+void seag::Console::print(std::string_view str, uint32_t y)
+{
+    print(str, 0, y);
+}
+
+void seag::Console::print(std::string_view str, uint32_t x, uint32_t y)
+{
+    m_cursor = { (float) x, (float) y };
+    print(str);
+}
+
+void seag::Console::print(const char* str)
+{
+    print(std::string_view(str));
+}
+
+void seag::Console::print(const char* str, uint32_t y)
+{
+    print(std::string_view(str), 0, y);
+}
+
+void seag::Console::print(const char* str, uint32_t x, uint32_t y)
+{
+    print(std::string_view(str), x, y);
+}
+
+void seag::Console::print(const StyledText& text)
+{
+    timePrint([this, &text]() {
+        const char32_t* characters = text.getCharacters().data();
+
+        for(const StyledText::Run& run : text.getRuns())
+        {
+            applyStyle(run.change);
+            putCharacters(characters + run.begin, characters + run.begin + run.length);
+        }
+    });
+}
+
+void seag::Console::print(const StyledText& text, uint32_t y)
+{
+    print(text, 0, y);
+}
+
+void seag::Console::print(const StyledText& text, uint32_t x, uint32_t y)
+{
+    m_cursor = { (float) x, (float) y };
+    print(text);
+}
+
+seag::Brush seag::Console::getDefaultBrush()
+{
+    return m_default_brush;
+}
+
+void seag::Console::setForegroundColor(sf::Color color)
+{
+    //Change active color to new color if it wasn't changed.
+    if(m_active_brush.foregroundColor == m_default_brush.foregroundColor)
+        m_active_brush.foregroundColor = color;
+
+    m_default_brush.foregroundColor = color;
+}
+
+void seag::Console::setBackgroundColor(sf::Color color)
+{
+    //Change active color to new color if it wasn't changed.
+    if(m_active_brush.backgroundColor == m_default_brush.backgroundColor)
+        m_active_brush.backgroundColor = color;
+
+    m_default_brush.backgroundColor = color;
+
+    //Empty cells and default backgrounds are drawn with this color.
+    invalidate();
+}
+
+void seag::Console::pushForegroundColor(sf::Color color)
+{
+    m_active_brush.foregroundColor = color;
+}
+
+void seag::Console::pushBackgroundColor(sf::Color color)
+{
+    m_active_brush.backgroundColor = color;
+}
+
+void seag::Console::pushBold(bool bold)
+{
+    m_active_brush.bold = bold;
+}
+
+void seag::Console::pushItalic(bool italic)
+{
+    m_active_brush.italic = italic;
+}
+
+void seag::Console::resetStyle()
+{
+    m_active_brush = m_default_brush;
+}
+
+bool seag::Console::isRetainedMode()
+{
+    return m_retained;
+}
+
+void seag::Console::setRetainedMode(bool retained)
+{
+    m_retained = retained;
+}
+
+void seag::Console::invalidate()
+{
+    m_screenBuffer.markDirty();
+}
+
+void seag::Console::clear()
+{
+    m_screenBuffer.setViewOffset(0);
+
+    //Clear screen buffer (unless it is retained) and reset cursor position.
+    if(!m_retained)
+        m_screenBuffer.clear();
+    m_cursor = { 0, 0 };
+
+    //Reset brush to default.
+    m_active_brush = m_default_brush;
+}
+
+uint32_t seag::Console::getScrollback()
+{
+    return m_screenBuffer.getScrollback();
+}
+
+void seag::Console::setScrollback(uint32_t rows)
+{
+    m_screenBuffer.setScrollback(rows);
+}
+
+uint32_t seag::Console::getScrollbackSize()
+{
+    return m_screenBuffer.getScrollbackSize();
+}
+
+uint64_t seag::Console::getFirstRow()
+{
+    return m_screenBuffer.getFirstRow();
+}
+
+uint32_t seag::Console::getViewOffset()
+{
+    return m_screenBuffer.getViewOffset();
+}
+
+void seag::Console::setViewOffset(uint32_t offset)
+{
+    m_screenBuffer.setViewOffset(offset);
+}
+
+void seag::Console::scrollView(int32_t rows)
+{
+    m_screenBuffer.setViewOffset(std::max<int64_t>((int64_t) m_screenBuffer.getViewOffset() + rows, 0));
+}
+
+void seag::Console::flush()
+{
+    sf::Clock clock;
+    uint32_t count = 0;
+
+    while(impl::PrintCommand* command = m_printQueue.pop())
+    {
+        applyCommand(*command);
+        delete command;
+        count++;
+    }
+
+    if(count > 0)
+    {
+        if(m_printTiming)
+            m_printTime += clock.getElapsedTime();
+        m_printCalls += count;
+    }
+}
+
+bool seag::Console::isPrintTiming()
+{
+    return m_printTiming;
+}
+
+void seag::Console::setPrintTiming(bool enabled)
+{
+    m_printTiming = enabled;
+}
+
+void seag::Console::applyCommand(const impl::PrintCommand& command)
+{
+    //Print with the cursor and brush of the printer, then keep them for its next commands.
+    impl::PrinterState& state = *command.state;
+    std::swap(m_cursor, state.cursor);
+    std::swap(m_active_brush, state.brush);
+
+    switch(command.type)
+    {
+        case impl::PrintCommand::Print:
+            printMarkup(command.text.data(), command.text.size());
+            break;
+        case impl::PrintCommand::PrintUtf32:
+            printMarkup(command.text32.data(), command.text32.size());
+            break;
+        case impl::PrintCommand::Cursor:
+            m_cursor = command.cursor;
+            break;
+        case impl::PrintCommand::Foreground:
+            m_active_brush.foregroundColor = command.color;
+            break;
+        case impl::PrintCommand::Background:
+            m_active_brush.backgroundColor = command.color;
+            break;
+        case impl::PrintCommand::Bold:
+            m_active_brush.bold = command.enabled;
+            break;
+        case impl::PrintCommand::Italic:
+            m_active_brush.italic = command.enabled;
+            break;
+        case impl::PrintCommand::Reset:
+            m_active_brush = m_default_brush;
+            break;
+    }
+
+    std::swap(m_cursor, state.cursor);
+    std::swap(m_active_brush, state.brush);
+}
+
+void seag::Console::applyStyle(const impl::StyleChange& change)
+{
+    if(change.flags & impl::StyleChange::Reset)
+        resetStyle();
+    if(change.flags & impl::StyleChange::ToggleBold)
+        pushBold(!m_active_brush.bold);
+    if(change.flags & impl::StyleChange::ToggleItalic)
+        pushItalic(!m_active_brush.italic);
+    if(change.flags & impl::StyleChange::Foreground)
+        pushForegroundColor(change.foregroundColor);
+    if(change.flags & impl::StyleChange::Background)
+        pushBackgroundColor(change.backgroundColor);
+}
+
+template<typename CharT>
+void seag::Console::printMarkup(const CharT* str, size_t length)
+{
+    struct Handler
+    {
+        Console& console;
+
+        void text(const CharT* begin, const CharT* end)
+        {
+            console.putCharacters(begin, end);
+        }
+
+        void style(const impl::StyleChange& change)
+        {
+            console.applyStyle(change);
+        }
+    } handler = { *this };
+
+    impl::parseMarkup(str, length, handler);
+}
+
+void seag::Console::putCharacter(char32_t character)
+{
+    //Printing shows the screen again if the view was moved into the scrollback.
+    if(m_screenBuffer.getViewOffset() > 0)
+        m_screenBuffer.setViewOffset(0);
+
+    if(character == U'\t')
+    {
+        impl::BufferCharacter bufferCharacter = { U' ', getBrushId(m_active_brush) };
+        for(int i = 0; i < 4; i++)
+            m_screenBuffer.set(m_cursor.x + i, m_cursor.y, bufferCharacter);
+        m_cursor.x += 4;
+    }
+    else if(character == U'\n')
+    {
+        m_cursor = { 0, m_cursor.y + 1 };
+
+        //With a scrollback, a new line past the last row scrolls the screen.
+        uint32_t rows = m_screenBuffer.getRows();
+        if(m_screenBuffer.getScrollback() > 0 && rows > 0 && m_cursor.y >= rows)
+        {
+            m_screenBuffer.scroll(m_cursor.y - rows + 1);
+            m_cursor.y = rows - 1;
+        }
+    }
+    else
+    {
+        m_screenBuffer.set(m_cursor.x, m_cursor.y, impl::BufferCharacter{ character, getBrushId(m_active_brush) });
+        m_cursor.x++;
+    }
+}
+
+void seag::Console::putCharacters(const char32_t* begin, const char32_t* end)
+{
+    for(const char32_t* c = begin; c != end; c++)
+        putCharacter(*c);
+}
+
+void seag::Console::putCharacters(const char* begin, const char* end)
+{
+    const char* c = begin;
+
+    if(m_screenBuffer.getViewOffset() > 0)
+        m_screenBuffer.setViewOffset(0);
+
+    while(c < end)
+    {
+        //Printable ASCII is copied as is (no decoding, tabs or new lines).
+        size_t count = impl::countPrintableAscii(c, end);
+        if(count > 0)
+        {
+            impl::BufferCharacter bufferCharacter = { 0, getBrushId(m_active_brush) };
+            for(size_t i = 0; i < count; i++)
+            {
+                bufferCharacter.code = (unsigned char) c[i];
+                m_screenBuffer.set(m_cursor.x + i, m_cursor.y, bufferCharacter);
+            }
+            m_cursor.x += count;
+            c += count;
+            continue;
+        }
+
+        char32_t character;
+        c = impl::decodeUtf8(c, end, character);
+        putCharacter(character);
+    }
+}
+
+void seag::Console::setCharacter(uint32_t x, uint32_t y, char32_t code, const Brush& brush)
+{
+    m_screenBuffer.set(x, y, impl::BufferCharacter{ code, getBrushId(brush) });
+}
+
+void seag::Console::fillRect(const sf::IntRect& rect, char32_t code)
+{
+    fillRect(rect, code, m_active_brush);
+}
+
+void seag::Console::fillRect(const sf::IntRect& rect, char32_t code, const Brush& brush)
+{
+    m_screenBuffer.fill(rect, impl::BufferCharacter{ code, getBrushId(brush) });
+}
+
+void seag::Console::clearRect(const sf::IntRect& rect)
+{
+    m_screenBuffer.fill(rect, impl::BufferCharacter{ 0, 0 });
+}
+
+void seag::Console::copyRect(const sf::IntRect& source, sf::Vector2i destination)
+{
+    sf::IntRect area = source;
+    sf::Vector2u size(getColumns(), getRows());
+    if(!impl::clipCopy(area, destination, size, size))
+        return;
+
+    m_screenBuffer.copy(m_screenBuffer.getView(area.left, area.top, area.width, area.height), destination.x, destination.y);
+}
+
+void seag::Console::blit(Console& sprite, sf::Vector2i position)
+{
+    blit(sprite, sf::IntRect(0, 0, sprite.getColumns(), sprite.getRows()), position);
+}
+
+void seag::Console::blit(Console& sprite, const sf::IntRect& rect, sf::Vector2i position)
+{
+    sf::IntRect area = rect;
+    if(!impl::clipCopy(area, position, { sprite.getColumns(), sprite.getRows() }, { getColumns(), getRows() }))
+        return;
+
+    impl::ScreenBufferView view = sprite.m_screenBuffer.getView(area.left, area.top, area.width, area.height);
+    m_blitCells.resize((size_t) view.columns * view.rows);
+
+    //Brush ids of the sprite are interned again in this console, sprites usually have runs of the same brush.
+    bool same = &sprite == this;
+
+    //A full table is compacted while interning, which changes the ids already written, so the cells are filled again (the table then only holds brushes on screen).
+    for(int attempt = 0; attempt < 2; attempt++)
+    {
+        uint32_t revision = m_brushes.getRevision();
+        uint16_t lastBrush = 0, lastId = 0;
+        bool resolved = false;
+
+        for(uint32_t y = 0; y < view.rows; y++)
+        {
+            const impl::BufferCharacter* source = view.getRow(y);
+            impl::BufferCharacter* cells = m_blitCells.data() + (size_t) y * view.columns;
+
+            if(same)
+            {
+                std::memcpy(cells, source, view.columns * sizeof(impl::BufferCharacter));
+                continue;
+            }
+
+            for(uint32_t x = 0; x < view.columns; x++)
+            {
+                if(source[x].code == 0)
+                {
+                    cells[x] = { 0, 0 };
+                    continue;
+                }
+
+                if(!resolved || source[x].brush != lastBrush)
+                {
+                    lastBrush = source[x].brush;
+                    lastId = getBrushId(sprite.m_brushes.get(lastBrush));
+                    resolved = true;
+                }
+
+                cells[x] = { source[x].code, lastId };
+            }
+        }
+
+        if(m_brushes.getRevision() == revision)
+            break;
+    }
+
+    m_screenBuffer.blit({ m_blitCells.data(), view.columns, view.rows, view.columns, &m_brushes, 0, 0 }, position.x, position.y);
+}
+
+uint16_t seag::Console::getBrushId(const Brush& brush)
+{
+    uint16_t id;
+    if(m_brushes.intern(brush, id))
+        return id;
+
+    //The table is full, brushes that are no longer on screen (or in the scrollback) are dropped.
+    compactBrushes();
+    if(m_brushes.intern(brush, id))
+        return id;
+
+    SEAG_ERROR_LOG("Too many brushes in the screen buffer, the empty cell brush is used.");
+    return 0;
+}
+
+void seag::Console::compactBrushes()
+{
+    std::vector<uint8_t> used(65536, 0);
+    m_screenBuffer.markBrushes(used);
+
+    std::vector<uint16_t> remap;
+    m_brushes.compact(used, remap);
+    m_screenBuffer.remapBrushes(remap);
+}
+
+seag::Printer::Printer(Console& console)
+    : m_console(&console),
+    m_state(new impl::PrinterState{ { 0, 0 }, Brush() })
+{
+    //The default brush is read by the console when it applies the commands, printers may be created on any thread.
+    resetStyle();
+}
+
+void seag::Printer::print(std::u32string_view str)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::PrintUtf32);
+    command->text32 = str;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::print(std::u32string_view str, uint32_t y)
+{
+    print(str, 0, y);
+}
+
+void seag::Printer::print(std::u32string_view str, uint32_t x, uint32_t y)
+{
+    setCursor({ (float) x, (float) y });
+    print(str);
+}
+
+void seag::Printer::print(std::string_view str)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Print);
+    command->text = str;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::print(std::string_view str, uint32_t y)
+{
+    print(str, 0, y);
+}
+
+void seag::Printer::print(std::string_view str, uint32_t x, uint32_t y)
+{
+    setCursor({ (float) x, (float) y });
+    print(str);
+}
+
+void seag::Printer::setCursor(sf::Vector2f cursor)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Cursor);
+    command->cursor = cursor;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::pushForegroundColor(sf::Color color)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Foreground);
+    command->color = color;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::pushBackgroundColor(sf::Color color)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Background);
+    command->color = color;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::pushBold(bool bold)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Bold);
+    command->enabled = bold;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::pushItalic(bool italic)
+{
+    impl::PrintCommand* command = createCommand(impl::PrintCommand::Italic);
+    command->enabled = italic;
+    m_console->m_printQueue.push(command);
+}
+
+void seag::Printer::resetStyle()
+{
+    m_console->m_printQueue.push(createCommand(impl::PrintCommand::Reset));
+}
+
+seag::impl::PrintCommand* seag::Printer::createCommand(impl::PrintCommand::Type type)
+{
+    //The state is shared with queued commands, so they stay valid if the printer is destroyed first.
+    impl::PrintCommand* command = new impl::PrintCommand();
+    command->state = m_state;
+    command->type = type;
+    return command;
+}
+
+seag::Layer::Layer(uint32_t columns, uint32_t rows)
+    : Console(columns, rows),
+    m_position(0, 0),
+    m_zOrder(0),
+    m_visible(true),
+    m_changed(false)
+{
+    m_default_brush.backgroundColor = sf::Color::Transparent;
+    m_active_brush = m_default_brush;
+}
+
+sf::Vector2i seag::Layer::getPosition()
+{
+    return m_position;
+}
+
+void seag::Layer::setPosition(sf::Vector2i position)
+{
+    m_position = position;
+    m_changed = true;
+}
+
+int seag::Layer::getZOrder()
+{
+    return m_zOrder;
+}
+
+void seag::Layer::setZOrder(int zOrder)
+{
+    m_zOrder = zOrder;
+    m_changed = true;
+}
+
+bool seag::Layer::isVisible()
+{
+    return m_visible;
+}
+
+void seag::Layer::setVisible(bool visible)
+{
+    m_visible = visible;
+    m_changed = true;
+}
+
+bool seag::Layer::isDirty()
+{
+    return m_screenBuffer.isDirty();
+}
+
+seag::World::World()
+    : m_view(),
+    m_hasView(false),
+    m_changed(false)
+{
+}
+
+seag::impl::ResolvedCharacter seag::World::getCharacter(int x, int y)
+{
+    int64_t chunkX = impl::floorDivide(x, SEAG_WORLD_CHUNK_SIZE);
+    int64_t chunkY = impl::floorDivide(y, SEAG_WORLD_CHUNK_SIZE);
+
+    impl::WorldChunk* chunk = getChunk(chunkX, chunkY, false);
+    if(chunk == nullptr)
+        return { 0, m_brushes.get(0) };
+
+    const impl::BufferCharacter& character = chunk->cells[(y - chunkY * SEAG_WORLD_CHUNK_SIZE) * SEAG_WORLD_CHUNK_SIZE + (x - chunkX * SEAG_WORLD_CHUNK_SIZE)];
+    return { character.code, m_brushes.get(character.brush) };
+}
+
+void seag::World::setCharacter(int x, int y, char32_t code, const Brush& brush)
+{
+    writeRect(sf::IntRect(x, y, 1, 1), impl::BufferCharacter{ code, getBrushId(brush) }, true);
+}
+
+void seag::World::fillRect(const sf::IntRect& rect, char32_t code, const Brush& brush)
+{
+    writeRect(rect, impl::BufferCharacter{ code, getBrushId(brush) }, true);
+}
+
+void seag::World::clearRect(const sf::IntRect& rect)
+{
+    //Missing chunks are already empty.
+    writeRect(rect, impl::BufferCharacter{ 0, 0 }, false);
+}
+
+void seag::World::clear()
+{
+    m_chunks.clear();
+    m_changed = true;
+}
+
+size_t seag::World::getChunkCount()
+{
+    return m_chunks.size();
+}
+
+size_t seag::World::getMemoryUsage()
+{
+    return m_chunks.size() * (sizeof(impl::WorldChunk) + SEAG_WORLD_CHUNK_SIZE * SEAG_WORLD_CHUNK_SIZE * sizeof(impl::BufferCharacter)) + m_brushes.getMemoryUsage();
+}
+
+bool seag::World::hasView()
+{
+    return m_hasView;
+}
+
+sf::View seag::World::getView()
+{
+    return m_view;
+}
+
+void seag::World::setView(const sf::View& view)
+{
+    m_view = view;
+    m_hasView = true;
+    m_changed = true;
+}
+
+void seag::World::resetView()
+{
+    m_hasView = false;
+    m_changed = true;
+}
+
+seag::impl::WorldChunk* seag::World::getChunk(int32_t x, int32_t y, bool create)
+{
+    uint64_t key = impl::getChunkKey(x, y);
+    auto it = m_chunks.find(key);
+    if(it != m_chunks.end())
+        return it->second.get();
+
+    if(!create)
+        return nullptr;
+
+    std::unique_ptr<impl::WorldChunk> chunk(new impl::WorldChunk{ std::vector<impl::BufferCharacter>(SEAG_WORLD_CHUNK_SIZE * SEAG_WORLD_CHUNK_SIZE, { 0, 0 }), true, nullptr });
+    return m_chunks.emplace(key, std::move(chunk)).first->second.get();
+}
+
+void seag::World::writeRect(const sf::IntRect& rect, const impl::BufferCharacter& character, bool create)
+{
+    if(rect.width <= 0 || rect.height <= 0)
+        return;
+
+    const int64_t size = SEAG_WORLD_CHUNK_SIZE;
+    int64_t left = rect.left, top = rect.top;
+    int64_t right = left + rect.width, bottom = top + rect.height;
+
+    for(int64_t chunkY = impl::floorDivide(top, size); chunkY * size < bottom; chunkY++)
+    {
+        for(int64_t chunkX = impl::floorDivide(left, size); chunkX * size < right; chunkX++)
+        {
+            impl::WorldChunk* chunk = getChunk(chunkX, chunkY, create);
+            if(chunk == nullptr)
+                continue;
+
+            //Part of the rectangle inside this chunk, in chunk cells.
+            int64_t startX = std::max(left, chunkX * size) - chunkX * size;
+            int64_t endX = std::min(right, (chunkX + 1) * size) - chunkX * size;
+            int64_t startY = std::max(top, chunkY * size) - chunkY * size;
+            int64_t endY = std::min(bottom, (chunkY + 1) * size) - chunkY * size;
+
+            for(int64_t y = startY; y < endY; y++)
+            {
+                impl::BufferCharacter* begin = chunk->cells.data() + y * size + startX;
+                impl::BufferCharacter* end = chunk->cells.data() + y * size + endX;
+                impl::BufferCharacter* first = std::find_if(begin, end, [&character](const impl::BufferCharacter& cell) {
+                    return cell.code != character.code || cell.brush != character.brush;
+                });
+
+                if(first == end)
+                    continue;
+
+                std::fill(first, end, character);
+                chunk->dirty = true;
+                m_changed = true;
+            }
+        }
+    }
+}
+
+uint16_t seag::World::getBrushId(const Brush& brush)
+{
+    uint16_t id;
+    if(m_brushes.intern(brush, id))
+        return id;
+
+    //The table is full, brushes no longer used by any chunk are dropped (chunk geometry holds colors, so chunks stay clean).
+    std::vector<uint8_t> used(65536, 0);
+    for(auto& entry : m_chunks)
+    {
+        for(const impl::BufferCharacter& cell : entry.second->cells)
+            used[cell.brush] = 1;
+    }
+
+    std::vector<uint16_t> remap;
+    m_brushes.compact(used, remap);
+    for(auto& entry : m_chunks)
+    {
+        for(impl::BufferCharacter& cell : entry.second->cells)
+            cell.brush = remap[cell.brush];
+    }
+
+    if(m_brushes.intern(brush, id))
+        return id;
+
+    SEAG_ERROR_LOG("Too many brushes in the world, the empty cell brush is used.");
+    return 0;
+}
+
+seag::Window::Window()
+    : Window("SEAG " + std::string(SEAG_VERSION), 500, 200)
+{
+}
+
+seag::Window::Window(const std::string& title, uint32_t width, uint32_t height)
+    : m_window(sf::VideoMode(width, height), title),
+    m_font(Font::getDefault()),
+    m_fontSize(11),
+    m_clearVertices(sf::Triangles),
+    m_backgroundVertices(sf::Triangles),
+    m_gridMode(false),
+    m_pendingFrame(),
+    m_renderFrame(),
+    m_threaded(false),
+    m_framePending(false),
+    m_renderStop(false),
+    m_stats(),
+    m_uniformUpdates(0),
+    m_statsOverlay(false),
+    m_overlayBackgroundVertices(sf::Triangles),
+    m_traceEmpty(true),
+    m_redrawPending(true),
+    m_timestep(sf::Time::Zero),
+    m_nextTimer(1)
+{
+    m_window.setVerticalSyncEnabled(true);
+
+    //The shader is compiled once for all windows (the texture uniform is the same for all of them).
+    m_shader = impl::Registry::get().getShader(impl::vertexShader, impl::fragmentShader);
+    if(!m_shader)
+    {
+        SEAG_FATAL_LOG("Could not load rendering shader files.");
+    }
+    m_shader->setUniform("texture", sf::Shader::CurrentTexture);
+    m_uniformUpdates++;
+
+    resizeScreenBuffer();
+}
+
+seag::Window::~Window()
+{
+    stopRenderThread();
+    stopTrace();
+}
+
+sf::RenderWindow& seag::Window::getNativeWindow()
+{
+    return m_window;
+}
+
+std::shared_ptr<seag::Font> seag::Window::getFont()
+{
+    return m_font;
+}
+
+void seag::Window::setFont(std::shared_ptr<Font> font)
+{
+    m_font = font;
+    invalidate();
+}
+
+int seag::Window::getFontSize()
+{
+    return m_fontSize;
+}
+
+void seag::Window::setFontSize(int fontSize)
+{
+    m_fontSize = fontSize;
+    resizeScreenBuffer();
+    invalidate();
+}
+
+sf::Vector2f seag::Window::getCellSize()
+{
+    return { (float) m_fontSize, m_fontSize * 2.f };
+}
+
+bool seag::Window::isOpen()
 {
     return m_window.isOpen();
 }
 
-bool seag::Window::waitEvent(sf::Event& event)
+bool seag::Window::waitEvent(sf::Event& event)
+{
+    if(!m_window.waitEvent(event))
+        return false;
+
+    handleEvent(event);
+    return true;
+}
+
+bool seag::Window::pollEvent(sf::Event& event)
+{
+    if(!m_window.pollEvent(event))
+        return false;
+
+    handleEvent(event);
+    return true;
+}
+
+void seag::Window::clear()
+{
+    //Clear SFML window (the render thread owns the window in threaded mode, and covers it with the canvas anyway).
+    if(!m_threaded)
+        m_window.clear(m_default_brush.backgroundColor);
+
+    Console::clear();
+}
+
+void seag::Window::display()
+{
+    if(m_threaded)
+    {
+        present();
+        return;
+    }
+
+    flush();
+    startFrame();
+    m_renderFrame = m_pendingFrame;
+    buildFrame(m_screenBuffer, prepareCanvas());
+    m_screenBuffer.clearDirty();
+    submitFrame();
+}
+
+void seag::Window::close()
+{
+    stopRenderThread();
+    m_window.close();
+}
+
+bool seag::Window::isGridMode()
+{
+    return m_gridMode;
+}
+
+bool seag::Window::setGridMode(bool enabled)
+{
+    if(enabled && !sf::Shader::isAvailable())
+    {
+        SEAG_ERROR_LOG("Grid mode needs shaders, which are not available.");
+        return false;
+    }
+
+    //The canvas and the cells texture are not updated while the other one is used, so all rows are drawn again.
+    if(enabled != m_gridMode)
+        invalidate();
+
+    m_gridMode = enabled;
+    return true;
+}
+
+bool seag::Window::isThreaded()
+{
+    return m_threaded;
+}
+
+void seag::Window::setThreaded(bool threaded)
+{
+    if(threaded == m_threaded)
+        return;
+
+    if(!threaded)
+    {
+        stopRenderThread();
+        return;
+    }
+
+    //The OpenGL context of the window can only be active in one thread.
+    m_window.setActive(false);
+    m_threaded = true;
+    m_renderThread = std::thread(&Window::renderLoop, this);
+}
+
+void seag::Window::present()
+{
+    if(!m_threaded)
+    {
+        display();
+        return;
+    }
+
+    //Printers write to the back buffer, before the frame is handed to the render thread.
+    flush();
+
+    std::unique_lock<std::mutex> lock(m_renderMutex);
+    m_renderCondition.wait(lock, [this]() { return !m_framePending; });
+
+    //The front buffer is drawn by the render thread while the next frame is printed in the back buffer.
+    std::swap(m_screenBuffer, m_frontBuffer);
+
+    //The back buffer gets the rows changed in the new front buffer, so it matches the canvas once the frame is drawn.
+    m_screenBuffer.copyDirtyRows(m_frontBuffer);
+    m_screenBuffer.clearDirty();
+
+    startFrame();
+    m_framePending = true;
+    lock.unlock();
+    m_renderCondition.notify_all();
+}
+
+bool seag::Window::needsRedraw()
+{
+    //Printer commands are applied like display() does, they may change rows.
+    flush();
+
+    if(m_redrawPending || m_statsOverlay || m_screenBuffer.isDirty())
+        return true;
+
+    //The canvas and the worlds following the window view are drawn again when the view moves.
+    if(!impl::isSameView(m_window.getView(), m_presentedView))
+        return true;
+
+    for(World* world : m_worlds)
+    {
+        if(world->m_changed)
+            return true;
+    }
+
+    for(Layer* layer : m_layers)
+    {
+        layer->flush();
+        if(layer->m_changed || (layer->m_visible && layer->m_screenBuffer.isDirty()))
+            return true;
+    }
+
+    return false;
+}
+
+void seag::Window::requestRedraw()
+{
+    m_redrawPending = true;
+}
+
+sf::Time seag::Window::getTimestep()
+{
+    return m_timestep;
+}
+
+void seag::Window::setTimestep(sf::Time timestep)
+{
+    m_timestep = std::max(timestep, sf::Time::Zero);
+}
+
+uint32_t seag::Window::addTimer(sf::Time interval, std::function<void()> callback, bool repeat)
+{
+    uint32_t id = m_nextTimer++;
+    m_timers.push_back({ id, interval, m_clock.getElapsedTime() + interval, std::move(callback), repeat });
+    return id;
+}
+
+void seag::Window::removeTimer(uint32_t id)
+{
+    m_timers.erase(std::remove_if(m_timers.begin(), m_timers.end(), [id](const impl::Timer& timer) { return timer.id == id; }), m_timers.end());
+}
+
+void seag::Window::run(const std::function<void(const sf::Event&)>& event, const std::function<void(sf::Time)>& update, const std::function<void()>& render)
+{
+    auto dispatch = [this, &event](const sf::Event& received) {
+        if(event)
+            event(received);
+        else if(received.type == sf::Event::Closed)
+            close();
+    };
+
+    sf::Time last = m_clock.getElapsedTime();
+    sf::Time accumulator = sf::Time::Zero;
+    m_redrawPending = true;
+
+    while(isOpen())
+    {
+        sf::Event received;
+        while(pollEvent(received))
+            dispatch(received);
+
+        if(!isOpen())
+            break;
+
+        sf::Time now = m_clock.getElapsedTime();
+        runTimers(now);
+
+        //Fixed steps catch up with the elapsed time (steps over the limit are dropped so a slow update cannot fall behind forever).
+        if(update && m_timestep > sf::Time::Zero)
+        {
+            accumulator += now - last;
+            for(int steps = 0; accumulator >= m_timestep; steps++)
+            {
+                if(steps == SEAG_MAX_UPDATE_STEPS)
+                {
+                    accumulator = sf::Time::Zero;
+                    break;
+                }
+
+                update(m_timestep);
+                accumulator -= m_timestep;
+            }
+        }
+        else if(update)
+            update(now - last);
+        last = now;
+
+        //Rows are only dirty if render() changed characters (a row cleared and printed again the same way is not).
+        if(render)
+            render();
+        if(needsRedraw())
+            display();
+
+        if(!isOpen() || needsRedraw())
+            continue;
+
+        //Nothing to draw: wait for an event, the next timer or the next update step.
+        sf::Time deadline = sf::Time::Zero;
+        for(const impl::Timer& timer : m_timers)
+            deadline = deadline == sf::Time::Zero ? timer.next : std::min(deadline, timer.next);
+        if(update && m_timestep > sf::Time::Zero)
+        {
+            sf::Time step = last + m_timestep - accumulator;
+            deadline = deadline == sf::Time::Zero ? step : std::min(deadline, step);
+        }
+
+        if(waitIdle(deadline, received))
+            dispatch(received);
+    }
+}
+
+void seag::Window::runTimers(sf::Time now)
+{
+    //Timers can add or remove timers, so due ones are collected first.
+    std::vector<uint32_t> due;
+    for(const impl::Timer& timer : m_timers)
+    {
+        if(timer.next <= now)
+            due.push_back(timer.id);
+    }
+
+    for(uint32_t id : due)
+    {
+        auto it = std::find_if(m_timers.begin(), m_timers.end(), [id](const impl::Timer& timer) { return timer.id == id; });
+        if(it == m_timers.end())
+            continue;
+
+        std::function<void()> callback = it->callback;
+        if(it->repeat && it->interval > sf::Time::Zero)
+            it->next = std::max(it->next + it->interval, now);
+        else
+            m_timers.erase(it);
+
+        callback();
+    }
+}
+
+bool seag::Window::waitIdle(sf::Time deadline, sf::Event& event)
+{
+    //Without a deadline the loop blocks until the next event.
+    if(deadline == sf::Time::Zero)
+        return waitEvent(event);
+
+    //SFML cannot wait for an event with a timeout, events are polled between short sleeps.
+    while(true)
+    {
+        if(pollEvent(event))
+            return true;
+
+        sf::Time left = deadline - m_clock.getElapsedTime();
+        if(left <= sf::Time::Zero)
+            return false;
+
+        sf::sleep(std::min(left, sf::milliseconds(SEAG_IDLE_POLL_INTERVAL)));
+    }
+}
+
+seag::FrameStats seag::Window::getStats()
+{
+    std::lock_guard<std::mutex> lock(m_renderMutex);
+    return m_stats;
+}
+
+bool seag::Window::isStatsOverlay()
+{
+    return m_statsOverlay;
+}
+
+void seag::Window::addLayer(Layer* layer)
+{
+    if(std::find(m_layers.begin(), m_layers.end(), layer) == m_layers.end())
+        m_layers.push_back(layer);
+    m_redrawPending = true;
+}
+
+void seag::Window::removeLayer(Layer* layer)
+{
+    m_layers.erase(std::remove(m_layers.begin(), m_layers.end(), layer), m_layers.end());
+    m_redrawPending = true;
+}
+
+void seag::Window::addWorld(World* world)
+{
+    if(std::find(m_worlds.begin(), m_worlds.end(), world) == m_worlds.end())
+        m_worlds.push_back(world);
+    m_redrawPending = true;
+}
+
+void seag::Window::removeWorld(World* world)
+{
+    m_worlds.erase(std::remove(m_worlds.begin(), m_worlds.end(), world), m_worlds.end());
+    m_redrawPending = true;
+}
+
+void seag::Window::setStatsOverlay(bool enabled)
+{
+    //The overlay shows the print time.
+    if(enabled)
+        m_printTiming = true;
+
+    m_statsOverlay = enabled;
+    m_redrawPending = true;
+}
+
+bool seag::Window::startTrace(const std::string& path)
+{
+    stopTrace();
+
+    std::lock_guard<std::mutex> lock(m_renderMutex);
+    m_trace.open(path);
+    if(!m_trace)
+    {
+        SEAG_ERROR_LOG("Could not open trace file " + path);
+        return false;
+    }
+
+    //JSON array format of the trace event format.
+    m_trace << "[";
+    m_traceEmpty = true;
+
+    //Print time is written with the other phases of each frame.
+    m_printTiming = true;
+    return true;
+}
+
+void seag::Window::stopTrace()
+{
+    std::lock_guard<std::mutex> lock(m_renderMutex);
+    if(!m_trace.is_open())
+        return;
+
+    m_trace << "\n]\n";
+    m_trace.close();
+}
+
+void seag::Window::resizeScreenBuffer()
+{
+    sf::Vector2u size = m_window.getSize();
+    sf::Vector2f cellSize = getCellSize();
+
+    //Partially visible cells at the right and bottom edges are kept.
+    uint32_t columns = std::ceil(size.x / cellSize.x);
+    uint32_t rows = std::ceil(size.y / cellSize.y);
+    m_screenBuffer.resize(columns, rows);
+}
+
+void seag::Window::handleEvent(const sf::Event& event)
+{
+    if(event.type == sf::Event::Resized)
+        resizeScreenBuffer();
+
+    //The canvas is recreated on resize, and some systems lose the window content when it is hidden.
+    if(event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+        m_redrawPending = true;
+}
+
+void seag::Window::startFrame()
+{
+    m_pendingFrame.font = m_font;
+    m_pendingFrame.brushes = &m_brushes;
+    m_pendingFrame.fontSize = m_fontSize;
+    m_pendingFrame.background = m_default_brush.backgroundColor;
+    m_pendingFrame.size = m_window.getSize();
+    m_pendingFrame.grid = m_gridMode;
+    m_presentedView = m_window.getView();
+    m_redrawPending = false;
+
+    prepareLayers();
+
+    m_pendingFrame.stats = {};
+    m_pendingFrame.stats.printTime = m_printTime;
+    m_pendingFrame.stats.printCalls = m_printCalls;
+    m_pendingFrame.stats.uniformUpdates = m_uniformUpdates;
+    m_printTime = sf::Time::Zero;
+    m_printCalls = 0;
+    m_uniformUpdates = 0;
+
+    prepareWorlds();
+}
+
+void seag::Window::prepareLayers()
+{
+    sf::Vector2f cellSize = getCellSize();
+    m_pendingFrame.layers.clear();
+
+    std::stable_sort(m_layers.begin(), m_layers.end(), [](Layer* a, Layer* b) { return a->m_zOrder < b->m_zOrder; });
+
+    //Layers keep their own background, only transparent cells are skipped.
+    impl::FrameState layerFrame = { m_font, nullptr, m_fontSize, sf::Color::Transparent, {}, false, {}, {}, {} };
+
+    for(Layer* layer : m_layers)
+    {
+        layer->flush();
+        layer->m_changed = false;
+
+        if(!layer->m_visible)
+            continue;
+
+        //Geometry is built again only if characters or the font changed (moving a layer only changes its offset).
+        const impl::LayerGeometry* geometry = layer->m_geometry.get();
+        //Glyphs evicted from a dynamic font may be used by the geometry, their slots can hold other glyphs.
+        if(geometry == nullptr || layer->m_screenBuffer.isDirty() || geometry->font != m_font || geometry->fontSize != m_fontSize || geometry->fontEvictions != m_font->getEvictionCount())
+        {
+            std::shared_ptr<impl::LayerGeometry> built(new impl::LayerGeometry{ sf::VertexArray(sf::Triangles), {}, m_font, m_fontSize, 0 });
+            const impl::ScreenBuffer& buffer = layer->m_screenBuffer;
+
+            for(uint32_t y = 0; y < buffer.getRows(); y++)
+            {
+                const impl::BufferCharacter* row = buffer.getRow(y);
+                for(uint32_t x = 0; x < buffer.getColumns(); x++)
+                {
+                    if(row[x].code != 0)
+                        appendCell(layerFrame, row[x].code, layer->m_brushes.get(row[x].brush), { x * cellSize.x, y * cellSize.y }, built->backgrounds, built->glyphs);
+                }
+            }
+
+            //Evictions while building only drop glyphs the layer does not use.
+            built->fontEvictions = m_font->getEvictionCount();
+            layer->m_geometry = built;
+            layer->m_screenBuffer.clearDirty();
+        }
+
+        m_pendingFrame.layers.push_back({ layer->m_geometry, { layer->m_position.x * cellSize.x, layer->m_position.y * cellSize.y } });
+    }
+}
+
+void seag::Window::prepareWorlds()
+{
+    sf::Vector2f cellSize = getCellSize();
+    sf::Vector2f chunkSize = cellSize * (float) SEAG_WORLD_CHUNK_SIZE;
+    const sf::View& windowView = m_window.getView();
+    m_pendingFrame.worlds.clear();
+
+    //Worlds keep their own background, only transparent cells are skipped.
+    impl::FrameState chunkFrame = { m_font, nullptr, m_fontSize, sf::Color::Transparent, {}, false, {}, {}, {} };
+
+    for(World* world : m_worlds)
+    {
+        world->m_changed = false;
+
+        //The window view is applied when drawing, so a world with its own view undoes it in its transform.
+        const sf::View& view = world->m_hasView ? world->m_view : windowView;
+        impl::WorldDraw draw;
+        if(world->m_hasView)
+            draw.transform = windowView.getInverseTransform() * view.getTransform();
+
+        //Chunks intersecting the bounding box of the view (rotated views included).
+        sf::FloatRect area = view.getInverseTransform().transformRect({ -1.f, -1.f, 2.f, 2.f });
+        double limit = std::numeric_limits<int32_t>::max();
+        int64_t left = std::max(-limit, std::min(limit, std::floor((double) area.left / chunkSize.x)));
+        int64_t top = std::max(-limit, std::min(limit, std::floor((double) area.top / chunkSize.y)));
+        int64_t right = std::max(-limit, std::min(limit, std::floor(((double) area.left + area.width) / chunkSize.x)));
+        int64_t bottom = std::max(-limit, std::min(limit, std::floor(((double) area.top + area.height) / chunkSize.y)));
+
+        auto addChunk = [&](int64_t x, int64_t y, impl::WorldChunk& chunk) {
+            //Geometry is built again only if characters or the font changed, chunks out of the view keep their old geometry until they are seen.
+            const impl::ChunkGeometry* geometry = chunk.geometry.get();
+            if(geometry == nullptr || chunk.dirty || geometry->vertices.font != m_font || geometry->vertices.fontSize != m_fontSize || geometry->vertices.fontEvictions != m_font->getEvictionCount())
+            {
+                std::shared_ptr<impl::ChunkGeometry> built(new impl::ChunkGeometry{
+                    { sf::VertexArray(sf::Triangles), {}, m_font, m_fontSize, 0 },
+                    sf::VertexBuffer(sf::Triangles, sf::VertexBuffer::Static), {}, false
+                });
+
+                for(uint32_t cellY = 0; cellY < SEAG_WORLD_CHUNK_SIZE; cellY++)
+                {
+                    const impl::BufferCharacter* row = chunk.cells.data() + cellY * SEAG_WORLD_CHUNK_SIZE;
+                    for(uint32_t cellX = 0; cellX < SEAG_WORLD_CHUNK_SIZE; cellX++)
+                    {
+                        if(row[cellX].code != 0)
+                            appendCell(chunkFrame, row[cellX].code, world->m_brushes.get(row[cellX].brush), { cellX * cellSize.x, cellY * cellSize.y }, built->vertices.backgrounds, built->vertices.glyphs);
+                    }
+                }
+
+                built->vertices.fontEvictions = m_font->getEvictionCount();
+                chunk.geometry = built;
+                chunk.dirty = false;
+                m_pendingFrame.stats.chunksBuilt++;
+            }
+
+            m_pendingFrame.stats.chunksDrawn++;
+            draw.chunks.push_back({ chunk.geometry, { x * chunkSize.x, y * chunkSize.y } });
+        };
+
+        //Chunks are looked up by position, unless the view holds more positions than there are chunks (zoomed out).
+        if((right - left + 1.0) * (bottom - top + 1.0) <= world->m_chunks.size())
+        {
+            for(int64_t y = top; y <= bottom; y++)
+            {
+                for(int64_t x = left; x <= right; x++)
+                {
+                    impl::WorldChunk* chunk = world->getChunk(x, y, false);
+                    if(chunk != nullptr)
+                        addChunk(x, y, *chunk);
+                }
+            }
+        }
+        else
+        {
+            for(auto& entry : world->m_chunks)
+            {
+                int32_t x = (int32_t) (entry.first >> 32), y = (int32_t) entry.first;
+                if(x >= left && x <= right && y >= top && y <= bottom)
+                    addChunk(x, y, *entry.second);
+            }
+        }
+
+        m_pendingFrame.worlds.push_back(std::move(draw));
+    }
+}
+
+bool seag::Window::prepareCanvas()
+{
+    //The canvas keeps the previous frame, it is recreated (and fully drawn) when the window size changes.
+    if(m_renderFrame.grid || m_canvas.getSize() == m_renderFrame.size)
+        return false;
+
+    if(!m_canvas.create(m_renderFrame.size.x, m_renderFrame.size.y))
+    {
+        SEAG_FATAL_LOG("Could not create the rendering canvas.");
+    }
+    return true;
+}
+
+void seag::Window::buildFrame(const impl::ScreenBuffer& buffer, bool redraw)
+{
+    sf::Time buildStart = m_clock.getElapsedTime();
+    sf::Vector2f cellSize = { (float) m_renderFrame.fontSize, m_renderFrame.fontSize * 2.f };
+    sf::Vector2u windowSize = m_canvas.getSize();
+
+    //Build the geometry of changed rows only (previous frame capacity is reused).
+    m_clearVertices.clear();
+    m_backgroundVertices.clear();
+    for(sf::VertexArray& vertices : m_glyphVertices)
+        vertices.clear();
+
+    //The grid renderer encodes the changed rows in its cells data instead.
+    if(m_renderFrame.grid)
+        m_grid.build(buffer, m_renderFrame);
+
+    for(uint32_t y = 0; y < buffer.getRows() && !m_renderFrame.grid; y++)
+    {
+        if(!redraw && !buffer.isRowDirty(y))
+            continue;
+
+        //Erase the previous content of the row.
+        impl::appendQuad(m_clearVertices, { 0, y * cellSize.y, (float) windowSize.x, cellSize.y }, m_renderFrame.background, {});
+        m_renderFrame.stats.rowsDrawn++;
+
+        const impl::BufferCharacter* row = buffer.getRow(y);
+
+        for(uint32_t x = 0; x < buffer.getColumns(); x++)
+        {
+            //Empty characters are not drawn.
+            if(row[x].code == 0)
+                continue;
+
+            appendCell(m_renderFrame, row[x].code, m_renderFrame.brushes->get(row[x].brush), { x * cellSize.x, y * cellSize.y }, m_backgroundVertices, m_glyphVertices);
+            m_renderFrame.stats.cellsDrawn++;
+        }
+    }
+
+    m_renderFrame.stats.buildTime = m_clock.getElapsedTime() - buildStart;
+    m_renderFrame.stats.bufferBytes = buffer.getMemoryUsage();
+    m_renderFrame.stats.glyphBytes = m_renderFrame.font->getGlyphMemoryUsage();
+}
+
+void seag::Window::submitFrame()
+{
+    sf::Time submitStart = m_clock.getElapsedTime();
+
+    //Glyphs rasterized by a dynamic font while building the frame (layers included) are uploaded before drawing.
+    m_renderFrame.font->update();
+
+    //Colors are read from the vertices so changed rows are drawn in three calls.
+    if(m_clearVertices.getVertexCount() > 0)
+    {
+        m_canvas.draw(m_clearVertices, sf::BlendNone);
+        m_canvas.draw(m_backgroundVertices);
+        m_renderFrame.stats.drawCalls += 2 + drawGlyphs(m_canvas, m_glyphVertices, m_renderFrame.font.get(), sf::Transform::Identity);
+        m_canvas.display();
+    }
+
+    //Composite the canvas (unchanged rows included) on the window, or draw the whole grid in one pass.
+    if(m_renderFrame.grid)
+        m_grid.draw(m_window, m_renderFrame);
+    else
+    {
+        m_window.draw(sf::Sprite(m_canvas.getTexture()));
+        m_renderFrame.stats.drawCalls++;
+    }
+
+    //Worlds are drawn over the canvas from the vertex buffers of their chunks in the view.
+    for(const impl::WorldDraw& world : m_renderFrame.worlds)
+    {
+        for(const impl::ChunkDraw& chunk : world.chunks)
+        {
+            sf::Transform transform = world.transform;
+            transform.translate(chunk.offset);
+            m_renderFrame.stats.drawCalls += drawChunk(*chunk.geometry, transform);
+        }
+    }
+
+    //Layers are drawn over the canvas with their prebuilt geometry.
+    for(const impl::LayerDraw& layer : m_renderFrame.layers)
+    {
+        sf::Transform transform;
+        transform.translate(layer.offset);
+
+        m_window.draw(layer.geometry->backgrounds, transform);
+        m_renderFrame.stats.drawCalls += 1 + drawGlyphs(m_window, layer.geometry->glyphs, layer.geometry->font.get(), transform);
+    }
+
+    //The overlay is drawn on the window only, so the canvas rows stay clean.
+    if(m_statsOverlay)
+    {
+        drawStatsOverlay();
+        m_renderFrame.stats.drawCalls++;
+    }
+
+    sf::Time presentStart = m_clock.getElapsedTime();
+    m_window.display();
+    sf::Time frameEnd = m_clock.getElapsedTime();
+
+    m_renderFrame.stats.frameTime = frameEnd - m_frameStart;
+    m_renderFrame.stats.submitTime = presentStart - submitStart;
+    m_renderFrame.stats.presentTime = frameEnd - presentStart;
+
+    std::lock_guard<std::mutex> lock(m_renderMutex);
+    if(m_trace.is_open())
+    {
+        writeTraceEvent("frame", m_frameStart, m_renderFrame.stats.frameTime);
+        writeTraceEvent("build", submitStart - m_renderFrame.stats.buildTime, m_renderFrame.stats.buildTime);
+        writeTraceEvent("submit", submitStart, m_renderFrame.stats.submitTime);
+        writeTraceEvent("present", presentStart, m_renderFrame.stats.presentTime);
+        writeTraceCounter("print_ms", m_frameStart, m_renderFrame.stats.printTime.asMicroseconds() / 1000.0);
+        writeTraceCounter("cells", frameEnd, m_renderFrame.stats.cellsDrawn);
+        writeTraceCounter("draw_calls", frameEnd, m_renderFrame.stats.drawCalls);
+    }
+
+    m_stats = m_renderFrame.stats;
+    m_frameStart = frameEnd;
+}
+
+void seag::Window::renderLoop()
+{
+    m_window.setActive(true);
+
+    std::unique_lock<std::mutex> lock(m_renderMutex);
+    while(true)
+    {
+        m_renderCondition.wait(lock, [this]() { return m_framePending || m_renderStop; });
+
+        //A pending frame is still drawn when stopping.
+        if(!m_framePending)
+            break;
+
+        //present() waits until the front buffer and the pending frame are no longer read.
+        m_renderFrame = m_pendingFrame;
+        buildFrame(m_frontBuffer, prepareCanvas());
+        m_framePending = false;
+        lock.unlock();
+        m_renderCondition.notify_all();
+
+        submitFrame();
+        lock.lock();
+    }
+
+    m_window.setActive(false);
+}
+
+void seag::Window::stopRenderThread()
+{
+    if(!m_renderThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_renderMutex);
+        m_renderStop = true;
+    }
+    m_renderCondition.notify_all();
+    m_renderThread.join();
+
+    m_renderStop = false;
+    m_threaded = false;
+    m_window.setActive(true);
+}
+
+void seag::Window::compactBrushes()
+{
+    //The render thread reads the front buffer brushes until the pending frame is built.
+    std::unique_lock<std::mutex> lock(m_renderMutex);
+    m_renderCondition.wait(lock, [this]() { return !m_framePending; });
+
+    std::vector<uint8_t> used(65536, 0);
+    m_screenBuffer.markBrushes(used);
+    m_frontBuffer.markBrushes(used);
+
+    std::vector<uint16_t> remap;
+    m_brushes.compact(used, remap);
+    m_screenBuffer.remapBrushes(remap);
+    m_frontBuffer.remapBrushes(remap);
+}
+
+void seag::Window::appendCell(const impl::FrameState& frame, char32_t code, const Brush& brush, sf::Vector2f pos, sf::VertexArray& backgrounds, std::vector<sf::VertexArray>& glyphs)
+{
+    sf::Vector2f cellSize = { (float) frame.fontSize, frame.fontSize * 2.f };
+    float scale = (cellSize.x / (float) frame.font->getGlyphSize())*2;
+
+    //The row is already cleared with the default background.
+    if(brush.backgroundColor != frame.background)
+        impl::appendQuad(backgrounds, { pos, cellSize }, brush.backgroundColor, {});
+
+    //Bold and italic glyphs are pre-baked, so each character is a single quad in the vertex array of its atlas page.
+    const impl::Glyph& glyph = frame.font->getGlyph(code, brush.bold, brush.italic);
+    sf::Vector2f size = { glyph.size.x * scale, glyph.size.y * scale };
+    sf::FloatRect quad = {
+        pos.x + cellSize.x/2 - size.x/2,
+        pos.y + glyph.origin.y*scale,
+        size.x, size.y
+    };
+    sf::FloatRect textureRect = {
+        (float) glyph.coords.x + glyph.origin.x,
+        (float) glyph.coords.y + glyph.origin.y,
+        glyph.size.x, glyph.size.y
+    };
+
+    if(glyphs.size() <= glyph.page)
+        glyphs.resize(glyph.page + 1, sf::VertexArray(sf::Triangles));
+
+    impl::appendQuad(glyphs[glyph.page], quad, brush.foregroundColor, textureRect);
+}
+
+uint32_t seag::Window::drawGlyphs(sf::RenderTarget& target, const std::vector<sf::VertexArray>& glyphs, Font* font, const sf::Transform& transform)
+{
+    uint32_t drawCalls = 0;
+
+    for(uint32_t page = 0; page < glyphs.size(); page++)
+    {
+        if(glyphs[page].getVertexCount() == 0)
+            continue;
+
+        target.draw(glyphs[page], sf::RenderStates(sf::BlendAlpha, transform, &font->getTexture(page), m_shader.get()));
+        drawCalls++;
+    }
+
+    return drawCalls;
+}
+
+uint32_t seag::Window::drawChunk(impl::ChunkGeometry& chunk, const sf::Transform& transform)
+{
+    Font* font = chunk.vertices.font.get();
+
+    if(!sf::VertexBuffer::isAvailable())
+    {
+        m_window.draw(chunk.vertices.backgrounds, transform);
+        return 1 + drawGlyphs(m_window, chunk.vertices.glyphs, font, transform);
+    }
+
+    //Vertices are uploaded once (the chunk is not changed after that, a new geometry is built), then only kept in GPU memory.
+    if(!chunk.uploaded)
+    {
+        if(chunk.vertices.backgrounds.getVertexCount() > 0 && chunk.backgrounds.create(chunk.vertices.backgrounds.getVertexCount()))
+            chunk.backgrounds.update(&chunk.vertices.backgrounds[0]);
+
+        chunk.glyphs.resize(chunk.vertices.glyphs.size(), sf::VertexBuffer(sf::Triangles, sf::VertexBuffer::Static));
+        for(size_t page = 0; page < chunk.glyphs.size(); page++)
+        {
+            const sf::VertexArray& vertices = chunk.vertices.glyphs[page];
+            if(vertices.getVertexCount() > 0 && chunk.glyphs[page].create(vertices.getVertexCount()))
+                chunk.glyphs[page].update(&vertices[0]);
+        }
+
+        chunk.vertices.backgrounds = sf::VertexArray(sf::Triangles);
+        chunk.vertices.glyphs.clear();
+        chunk.uploaded = true;
+    }
+
+    uint32_t drawCalls = 0;
+    if(chunk.backgrounds.getVertexCount() > 0)
+    {
+        m_window.draw(chunk.backgrounds, transform);
+        drawCalls++;
+    }
+
+    for(uint32_t page = 0; page < chunk.glyphs.size(); page++)
+    {
+        if(chunk.glyphs[page].getVertexCount() == 0)
+            continue;
+
+        m_window.draw(chunk.glyphs[page], sf::RenderStates(sf::BlendAlpha, transform, &font->getTexture(page), m_shader.get()));
+        drawCalls++;
+    }
+
+    return drawCalls;
+}
+
+void seag::Window::drawStatsOverlay()
+{
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2);
+    text << "frame   " << m_stats.frameTime.asMicroseconds() / 1000.0 << " ms\n";
+    text << "print   " << m_stats.printTime.asMicroseconds() / 1000.0 << " ms (" << m_stats.printCalls << " calls)\n";
+    text << "build   " << m_stats.buildTime.asMicroseconds() / 1000.0 << " ms\n";
+    text << "submit  " << m_stats.submitTime.asMicroseconds() / 1000.0 << " ms\n";
+    text << "present " << m_stats.presentTime.asMicroseconds() / 1000.0 << " ms\n";
+    text << "draws " << m_stats.drawCalls << " uniforms " << m_stats.uniformUpdates << "\n";
+    text << "rows " << m_stats.rowsDrawn << " cells " << m_stats.cellsDrawn << "\n";
+    text << "chunks " << m_stats.chunksDrawn << " built " << m_stats.chunksBuilt << "\n";
+    text << "buffer " << m_stats.bufferBytes / 1024.0 << " KB glyphs " << m_stats.glyphBytes / 1024.0 << " KB";
+
+    //Split the text in lines to size the panel.
+    std::vector<std::string> lines;
+    std::string line;
+    std::istringstream stream(text.str());
+    size_t width = 0;
+    while(std::getline(stream, line))
+    {
+        width = std::max(width, line.size());
+        lines.push_back(line);
+    }
+
+    sf::Vector2f cellSize = { (float) m_renderFrame.fontSize, m_renderFrame.fontSize * 2.f };
+    sf::Vector2f origin = { m_renderFrame.size.x - (width + 2) * cellSize.x, 0 };
+
+    m_overlayBackgroundVertices.clear();
+    for(sf::VertexArray& vertices : m_overlayGlyphVertices)
+        vertices.clear();
+    impl::appendQuad(m_overlayBackgroundVertices, { origin, { (width + 2) * cellSize.x, lines.size() * cellSize.y } }, sf::Color(0, 0, 0, 192), {});
+
+    //Backgrounds of the characters are transparent so only the panel is drawn behind them.
+    Brush brush = { sf::Color::White, sf::Color::Transparent, false, false };
+    for(size_t y = 0; y < lines.size(); y++)
+    {
+        for(size_t x = 0; x < lines[y].size(); x++)
+        {
+            if(lines[y][x] == ' ')
+                continue;
+
+            appendCell(m_renderFrame, lines[y][x], brush, { origin.x + (x + 1) * cellSize.x, origin.y + y * cellSize.y }, m_overlayBackgroundVertices, m_overlayGlyphVertices);
+        }
+    }
+
+    m_window.draw(m_overlayBackgroundVertices);
+    m_renderFrame.stats.drawCalls += drawGlyphs(m_window, m_overlayGlyphVertices, m_renderFrame.font.get(), sf::Transform::Identity);
+}
+
+void seag::Window::writeTraceEvent(const std::string& name, sf::Time start, sf::Time duration)
+{
+    m_trace << (m_traceEmpty ? "\n" : ",\n");
+    m_trace << "{ \"name\": \"" << name << "\", \"cat\": \"seag\", \"ph\": \"X\", \"ts\": " << start.asMicroseconds() << ", \"dur\": " << duration.asMicroseconds() << ", \"pid\": 1, \"tid\": 1 }";
+    m_traceEmpty = false;
+}
+
+void seag::Window::writeTraceCounter(const std::string& name, sf::Time time, double value)
+{
+    m_trace << (m_traceEmpty ? "\n" : ",\n");
+    m_trace << "{ \"name\": \"" << name << "\", \"cat\": \"seag\", \"ph\": \"C\", \"ts\": " << time.asMicroseconds() << ", \"pid\": 1, \"args\": { \"value\": " << value << " } }";
+    m_traceEmpty = false;
+}
+
+seag::Terminal::Terminal(int output)
+    : Terminal(80, 25, output)
+{
+    updateSize();
+}
+
+seag::Terminal::Terminal(uint32_t columns, uint32_t rows, int output)
+    : Console(columns, rows),
+    m_output(output),
+    m_started(false),
+    m_previousColumns(0),
+    m_previousRows(0),
+    m_redraw(true),
+    m_writtenBytes(0),
+    m_sgrValid(false),
+    m_cursorX(0),
+    m_cursorY(0),
+    m_cursorValid(false)
+{
+}
+
+seag::Terminal::~Terminal()
+{
+    if(!m_started)
+        return;
+
+    //Reset the colors, show the cursor and go back to the main screen.
+    m_data += "\x1b[0m\x1b[?25h\x1b[?1049l";
+    writeData();
+}
+
+int seag::Terminal::getOutput()
+{
+    return m_output;
+}
+
+bool seag::Terminal::updateSize()
+{
+#ifndef _WIN32
+    struct winsize size;
+    if(ioctl(m_output, TIOCGWINSZ, &size) != 0 || size.ws_col == 0 || size.ws_row == 0)
+        return false;
+
+    if(size.ws_col == getColumns() && size.ws_row == getRows())
+        return false;
+
+    resize(size.ws_col, size.ws_row);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void seag::Terminal::display()
+{
+    flush();
+
+    if(!m_started)
+    {
+        //Use the alternate screen (the shell content is back on exit) and hide the cursor.
+        m_data += "\x1b[?1049h\x1b[?25l";
+        m_started = true;
+    }
+
+    uint32_t columns = m_screenBuffer.getColumns();
+    uint32_t rows = m_screenBuffer.getRows();
+
+    if(m_redraw || columns != m_previousColumns || rows != m_previousRows)
+    {
+        //The terminal is cleared with its default colors and no cell matches the last frame.
+        m_data += "\x1b[0m\x1b[2J";
+        m_previous.assign((size_t) columns * rows, impl::BufferCharacter{ 0xFFFFFFFF, 0 });
+        m_previousColumns = columns;
+        m_previousRows = rows;
+        m_sgrValid = false;
+        m_cursorValid = false;
+        m_redraw = false;
+        m_screenBuffer.markDirty();
+    }
+
+    for(uint32_t y = 0; y < rows; y++)
+    {
+        if(!m_screenBuffer.isRowDirty(y))
+            continue;
+
+        const impl::BufferCharacter* row = m_screenBuffer.getRow(y);
+        impl::BufferCharacter* previous = m_previous.data() + (size_t) y * columns;
+
+        //Writing over either half of a wide character erases it, so the other half is written again.
+        for(uint32_t x = 0; x < columns; x++)
+        {
+            bool changed = row[x].code != previous[x].code || row[x].brush != previous[x].brush;
+            if(!changed)
+                continue;
+
+            if(x > 0 && impl::isWideCharacter(previous[x - 1].code))
+                previous[x - 1].code = 0xFFFFFFFF;
+            if(x + 1 < columns && impl::isWideCharacter(previous[x].code))
+                previous[x + 1].code = 0xFFFFFFFF;
+        }
+
+        for(uint32_t x = 0; x < columns; x++)
+        {
+            if(row[x].code == previous[x].code && row[x].brush == previous[x].brush)
+                continue;
+
+            moveCursor(x, y, row);
+            setBrush(m_brushes.get(row[x].brush));
+            putCell(row[x]);
+            previous[x] = row[x];
+
+            //A wide character covers the next cell, which is written again if the character changes.
+            if(impl::isWideCharacter(row[x].code) && x + 1 < columns)
+            {
+                previous[x + 1] = row[x + 1];
+                x++;
+            }
+        }
+    }
+
+    m_screenBuffer.clearDirty();
+    writeData();
+}
+
+void seag::Terminal::redraw()
+{
+    m_redraw = true;
+}
+
+uint64_t seag::Terminal::getWrittenBytes()
+{
+    return m_writtenBytes;
+}
+
+void seag::Terminal::moveCursor(uint32_t x, uint32_t y, const impl::BufferCharacter* row)
+{
+    if(m_cursorValid && m_cursorY == y && m_cursorX == x)
+        return;
+
+    if(m_cursorValid && m_cursorY == y && x > m_cursorX)
+    {
+        uint32_t gap = x - m_cursorX;
+        std::string count = gap > 1 ? std::to_string(gap) : "";
+
+        //Unchanged ASCII cells with the current brush are shorter to write again than a cursor move.
+        bool rewrite = m_sgrValid && gap < 3 + count.size();
+        for(uint32_t i = m_cursorX; i < x && rewrite; i++)
+            rewrite = row[i].code < 0x7F && m_brushes.get(row[i].brush) == m_sgr;
+
+        if(rewrite)
+        {
+            for(uint32_t i = m_cursorX; i < x; i++)
+                putCell(row[i]);
+        }
+        else
+        {
+            m_data += "\x1b[" + count + "C";
+            m_cursorX = x;
+        }
+        return;
+    }
+
+    if(m_cursorValid && x == 0 && y == m_cursorY + 1)
+        m_data += "\r\n";
+    else if(x == 0)
+        m_data += y == 0 ? "\x1b[H" : "\x1b[" + std::to_string(y + 1) + "H";
+    else
+        m_data += "\x1b[" + std::to_string(y + 1) + ";" + std::to_string(x + 1) + "H";
+
+    m_cursorX = x;
+    m_cursorY = y;
+    m_cursorValid = true;
+}
+
+void seag::Terminal::setBrush(const Brush& brush)
+{
+    if(m_sgrValid && brush == m_sgr)
+        return;
+
+    //Transparent colors are the default colors of the terminal.
+    auto appendColor = [this](const char* prefix, const char* fallback, sf::Color color) {
+        m_data += m_data.back() == '[' ? "" : ";";
+        if(color.a == 0)
+            m_data += fallback;
+        else
+            m_data += std::string(prefix) + std::to_string(color.r) + ";" + std::to_string(color.g) + ";" + std::to_string(color.b);
+    };
+
+    m_data += "\x1b[";
+
+    //Without a known state, attributes are reset and all parameters are written.
+    if(!m_sgrValid)
+    {
+        m_data += "0";
+        m_sgr = { sf::Color::Transparent, sf::Color::Transparent, false, false };
+    }
+
+    if(brush.foregroundColor != m_sgr.foregroundColor && !(brush.foregroundColor.a == 0 && m_sgr.foregroundColor.a == 0))
+        appendColor("38;2;", "39", brush.foregroundColor);
+    if(brush.backgroundColor != m_sgr.backgroundColor && !(brush.backgroundColor.a == 0 && m_sgr.backgroundColor.a == 0))
+        appendColor("48;2;", "49", brush.backgroundColor);
+    if(brush.bold != m_sgr.bold)
+        m_data += m_data.back() == '[' ? (brush.bold ? "1" : "22") : (brush.bold ? ";1" : ";22");
+    if(brush.italic != m_sgr.italic)
+        m_data += m_data.back() == '[' ? (brush.italic ? "3" : "23") : (brush.italic ? ";3" : ";23");
+
+    m_data += "m";
+    m_sgr = brush;
+    m_sgrValid = true;
+}
+
+void seag::Terminal::putCell(const impl::BufferCharacter& cell)
+{
+    //Control characters would move the cursor or change the terminal state, wide characters on the last column would wrap.
+    bool wide = impl::isWideCharacter(cell.code);
+    if(cell.code < 0x20 || (cell.code >= 0x7F && cell.code < 0xA0) || (wide && m_cursorX + 1 >= m_previousColumns))
+    {
+        m_data.push_back(' ');
+        wide = false;
+    }
+    else
+        impl::encodeUtf8(m_data, cell.code);
+
+    m_cursorX += wide ? 2 : 1;
+
+    //On the last column the cursor waits for the next character to wrap, so its position is not known.
+    if(m_cursorX >= m_previousColumns)
+        m_cursorValid = false;
+}
+
+bool seag::Terminal::writeData()
+{
+    size_t offset = 0;
+    while(offset < m_data.size())
+    {
+#ifndef _WIN32
+        ssize_t written = ::write(m_output, m_data.data() + offset, m_data.size() - offset);
+        if(written < 0 && errno == EINTR)
+            continue;
+#else
+        int written = _write(m_output, m_data.data() + offset, m_data.size() - offset);
+#endif
+        if(written <= 0)
+        {
+            SEAG_ERROR_LOG("Failed to write to the terminal.");
+            m_data.clear();
+            m_redraw = true;
+            return false;
+        }
+
+        offset += written;
+        m_writtenBytes += written;
+    }
+
+    m_data.clear();
+    return true;
+}
+
+void seag::Terminal::compactBrushes()
+{
+    std::vector<uint8_t> used(65536, 0);
+    m_screenBuffer.markBrushes(used);
+    for(const impl::BufferCharacter& cell : m_previous)
+        used[cell.brush] = 1;
+
+    std::vector<uint16_t> remap;
+    m_brushes.compact(used, remap);
+    m_screenBuffer.remapBrushes(remap);
+    for(impl::BufferCharacter& cell : m_previous)
+        cell.brush = remap[cell.brush];
+}
+
+seag::Rasterizer::Rasterizer()
+    : m_font(Font::getDefault()),
+    m_fontSize(11),
+    m_threadCount(0),
+    m_brightnessFont(nullptr),
+    m_brightnessRevision(0),
+    m_bitmapsFont(nullptr),
+    m_bitmapsFontSize(0)
+{
+}
+
+seag::Rasterizer::Rasterizer(std::shared_ptr<Font> font, int fontSize)
+    : m_font(font),
+    m_fontSize(fontSize),
+    m_threadCount(0),
+    m_brightnessFont(nullptr),
+    m_brightnessRevision(0),
+    m_bitmapsFont(nullptr),
+    m_bitmapsFontSize(0)
+{
+}
+
+std::shared_ptr<seag::Font> seag::Rasterizer::getFont()
+{
+    return m_font;
+}
+
+void seag::Rasterizer::setFont(std::shared_ptr<Font> font)
+{
+    //The previous font may be freed and a new one loaded at the same address, so the caches are not kept.
+    if(font != m_font)
+    {
+        m_brightnessFont = nullptr;
+        m_bitmapsFont = nullptr;
+    }
+
+    m_font = font;
+}
+
+int seag::Rasterizer::getFontSize()
+{
+    return m_fontSize;
+}
+
+void seag::Rasterizer::setFontSize(int fontSize)
+{
+    m_fontSize = fontSize;
+}
+
+sf::Vector2f seag::Rasterizer::getCellSize()
+{
+    return { (float) m_fontSize, m_fontSize * 2.f };
+}
+
+sf::Vector2u seag::Rasterizer::getImageSize(uint32_t columns, uint32_t rows)
+{
+    sf::Vector2f cellSize = getCellSize();
+    return { (unsigned int) (columns * cellSize.x), (unsigned int) (rows * cellSize.y) };
+}
+
+unsigned int seag::Rasterizer::getThreadCount()
+{
+    return m_threadCount;
+}
+
+void seag::Rasterizer::setThreadCount(unsigned int count)
+{
+    m_threadCount = count;
+}
+
+void seag::Rasterizer::render(Console& console, sf::Image& image)
+{
+    impl::ScreenBufferView view = console.getScreenBuffer();
+    sf::Vector2u size = getImageSize(view.columns, view.rows);
+
+    m_pixels.resize((size_t) size.x * size.y * 4);
+    render(view, console.getDefaultBrush().backgroundColor, m_pixels.data(), size.x, size.y);
+    image.create(size.x, size.y, m_pixels.data());
+}
+
+void seag::Rasterizer::render(const impl::ScreenBufferView& view, sf::Color background, uint8_t* pixels, uint32_t width, uint32_t height)
+{
+    //Glyph bitmaps are built before threads start, so they only read the cache.
+    prepareBitmaps(view);
+
+    //Rows of characters never overlap vertically, so each thread draws its own band of rows.
+    unsigned int threadCount = m_threadCount > 0 ? m_threadCount : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min<unsigned int>(threadCount, view.rows);
+
+    if(threadCount <= 1)
+    {
+        renderRows(view, background, pixels, width, height, 0, view.rows);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    for(unsigned int i = 1; i < threadCount; i++)
+        threads.emplace_back(&Rasterizer::renderRows, this, std::cref(view), background, pixels, width, height, view.rows * i / threadCount, view.rows * (i + 1) / threadCount);
+
+    renderRows(view, background, pixels, width, height, 0, view.rows / threadCount);
+
+    for(std::thread& thread : threads)
+        thread.join();
+}
+
+void seag::Rasterizer::renderRows(const impl::ScreenBufferView& view, sf::Color background, uint8_t* pixels, uint32_t width, uint32_t height, uint32_t first_row, uint32_t last_row)
+{
+    sf::Vector2f cellSize = getCellSize();
+
+    int bandTop = std::min<int>(first_row * cellSize.y, height);
+    int bandBottom = std::min<int>(last_row * cellSize.y, height);
+
+    //Clear the band with the default background.
+    uint32_t backgroundPixel;
+    uint8_t backgroundBytes[4] = { background.r, background.g, background.b, background.a };
+    std::memcpy(&backgroundPixel, backgroundBytes, 4);
+    std::fill_n((uint32_t*) (pixels + (size_t) bandTop * width * 4), (size_t) (bandBottom - bandTop) * width, backgroundPixel);
+
+    //Scratch coverage of a glyph row with a transparent foreground (sized to the widest bitmap drawn).
+    std::vector<uint8_t> coverage;
+
+    for(uint32_t y = first_row; y < last_row; y++)
+    {
+        const impl::BufferCharacter* row = view.getRow(y);
+        int rowTop = std::min<int>(y * cellSize.y, height);
+        int rowBottom = std::min<int>((y + 1) * cellSize.y, height);
+
+        //Glyphs are wider than cells, so all backgrounds of the row are filled before any glyph is blended (like Window::display).
+        for(uint32_t x = 0; x < view.columns; x++)
+        {
+            const impl::BufferCharacter& bufferChar = row[x];
+
+            //Empty characters are not drawn.
+            if(bufferChar.code == 0)
+                continue;
+
+            const Brush& brush = view.brushes->get(bufferChar.brush);
+            if(brush.backgroundColor == background)
+                continue;
+
+            int left = std::min<int>(x * cellSize.x, width);
+            int right = std::min<int>(x * cellSize.x + cellSize.x, width);
+            uint32_t cellPixel;
+            uint8_t cellBytes[4] = { brush.backgroundColor.r, brush.backgroundColor.g, brush.backgroundColor.b, brush.backgroundColor.a };
+            std::memcpy(&cellPixel, cellBytes, 4);
+
+            for(int py = rowTop; py < rowBottom; py++)
+                std::fill_n((uint32_t*) (pixels + ((size_t) py * width + left) * 4), right - left, cellPixel);
+        }
+
+        for(uint32_t x = 0; x < view.columns; x++)
+        {
+            const impl::BufferCharacter& bufferChar = row[x];
+            if(bufferChar.code == 0)
+                continue;
+
+            sf::Vector2i pos = { (int) (x * cellSize.x), (int) (y * cellSize.y) };
+            const Brush& brush = view.brushes->get(bufferChar.brush);
+
+            //Blend the cached coverage of the glyph (clipped to the row and the image).
+            const impl::GlyphBitmap& bitmap = m_bitmaps.find(impl::getBitmapKey(bufferChar.code, brush.bold, brush.italic))->second;
+            sf::Color color = brush.foregroundColor;
+
+            int left = std::max(pos.x + bitmap.left, 0);
+            int right = std::min<int>(pos.x + bitmap.left + bitmap.width, width);
+            int top = std::max(pos.y + bitmap.top, rowTop);
+            int bottom = std::min(pos.y + bitmap.top + bitmap.height, rowBottom);
+            if(left >= right)
+                continue;
+
+            if(color.a != 255 && coverage.size() < (size_t) (right - left))
+                coverage.resize(right - left);
+
+            for(int py = top; py < bottom; py++)
+            {
+                const uint8_t* rowCoverage = bitmap.coverage.data() + (size_t) (py - pos.y - bitmap.top) * bitmap.width + (left - pos.x - bitmap.left);
+
+                //Transparent foregrounds scale the coverage.
+                if(color.a != 255)
+                {
+                    for(int i = 0; i < right - left; i++)
+                        coverage[i] = rowCoverage[i] * color.a / 255;
+                    rowCoverage = coverage.data();
+                }
+
+                impl::blendSpan(pixels + ((size_t) py * width + left) * 4, rowCoverage, right - left, color);
+            }
+        }
+    }
+}
+
+void seag::Rasterizer::prepareBitmaps(const impl::ScreenBufferView& view)
 {
-    return m_window.waitEvent(event);
+    //Bitmaps depend on the font and its size.
+    if(m_bitmapsFont != m_font.get() || m_bitmapsFontSize != m_fontSize)
+    {
+        m_bitmaps.clear();
+        m_bitmapsFont = m_font.get();
+        m_bitmapsFontSize = m_fontSize;
+    }
+
+    std::vector<uint64_t> missing;
+    for(uint32_t y = 0; y < view.rows; y++)
+    {
+        const impl::BufferCharacter* row = view.getRow(y);
+
+        for(uint32_t x = 0; x < view.columns; x++)
+        {
+            if(row[x].code == 0)
+                continue;
+
+            const Brush& brush = view.brushes->get(row[x].brush);
+            uint64_t key = impl::getBitmapKey(row[x].code, brush.bold, brush.italic);
+            if(m_bitmaps.emplace(key, impl::GlyphBitmap()).second)
+                missing.push_back(key);
+        }
+    }
+
+    //Dynamic fonts rasterize all missing glyphs, then copy them to their pages in one update (keys hold the code and styles, see impl::getBitmapKey).
+    if(m_font->isDynamic())
+    {
+        for(uint64_t key : missing)
+            m_font->getGlyph(key & 0xFFFFFFFF, (key >> 32) & 1, (key >> 33) & 1);
+    }
+    m_font->update();
+
+    for(uint64_t key : missing)
+        buildBitmap(key & 0xFFFFFFFF, (key >> 32) & 1, (key >> 33) & 1, m_bitmaps[key]);
 }
 
-bool seag::Window::pollEvent(sf::Event& event)
+void seag::Rasterizer::buildBitmap(char32_t code, bool bold, bool italic, impl::GlyphBitmap& bitmap)
+{
+    sf::Vector2f cellSize = getCellSize();
+    float scale = (cellSize.x / (float) m_font->getGlyphSize())*2;
+
+    //Place the glyph like Window::display, relative to the top left corner of the cell (bold and italic are pre-baked by the font).
+    const impl::Glyph& glyph = m_font->getGlyph(code, bold, italic);
+    sf::Vector2f size = { glyph.size.x * scale, glyph.size.y * scale };
+    sf::FloatRect quad = { cellSize.x/2 - size.x/2, glyph.origin.y*scale, size.x, size.y };
+
+    bitmap = { 0, 0, 0, 0, {} };
+    if(quad.width <= 0 || quad.height <= 0)
+        return;
+
+    //Bounds of the quad (rows are clipped to the cell).
+    bitmap.left = std::floor(quad.left);
+    bitmap.top = std::max<int>(std::floor(quad.top), 0);
+    bitmap.width = std::ceil(quad.left + quad.width) - bitmap.left;
+    bitmap.height = std::min<int>(std::ceil(quad.top + quad.height), cellSize.y) - bitmap.top;
+    if(bitmap.width <= 0 || bitmap.height <= 0)
+    {
+        bitmap = { 0, 0, 0, 0, {} };
+        return;
+    }
+    bitmap.coverage.assign((size_t) bitmap.width * bitmap.height, 0);
+
+    const uint8_t* brightness = getBrightness(glyph.page);
+    int atlasWidth = m_font->getImage(glyph.page).getSize().x, atlasHeight = m_font->getImage(glyph.page).getSize().y;
+    int texLeft = glyph.coords.x + glyph.origin.x, texTop = glyph.coords.y + glyph.origin.y;
+    float texScaleX = glyph.size.x / quad.width, texScaleY = glyph.size.y / quad.height;
+
+    for(int py = bitmap.top; py < bitmap.top + bitmap.height; py++)
+    {
+        //Pixels are covered when their center is inside the quad (like OpenGL rasterization).
+        float centerY = py + 0.5f;
+        if(centerY < quad.top || centerY >= quad.top + quad.height)
+            continue;
+
+        const uint8_t* texRow = brightness + (size_t) std::min<int>(texTop + (int) ((centerY - quad.top) * texScaleY), atlasHeight - 1) * atlasWidth;
+        uint8_t* bitmapRow = bitmap.coverage.data() + (size_t) (py - bitmap.top) * bitmap.width;
+
+        for(int i = 0; i < bitmap.width; i++)
+        {
+            float offset = bitmap.left + i + 0.5f - quad.left;
+            if(offset < 0 || offset >= quad.width)
+                continue;
+
+            //The atlas brightness is used as the coverage of the foreground color (see impl::fragmentShader).
+            bitmapRow[i] = texRow[std::min<int>(texLeft + (int) (offset * texScaleX), atlasWidth - 1)];
+        }
+    }
+}
+
+uint64_t seag::impl::getBitmapKey(char32_t code, bool bold, bool italic)
 {
-    return m_window.pollEvent(event);
+    return (uint64_t) code | ((uint64_t) bold << 32) | ((uint64_t) italic << 33);
 }
 
-void seag::Window::clear()
+const uint8_t* seag::Rasterizer::getBrightness(uint32_t page)
 {
-    //Clear SFML window.
-    m_window.clear(m_default_brush.backgroundColor);
+    //The brightness of the atlas pages is computed once per font (again when glyphs are added to a dynamic font).
+    if(m_brightnessFont != m_font.get() || m_brightnessRevision != m_font->getRevision())
+    {
+        m_brightness.assign(m_font->getPageCount(), {});
+        m_brightnessFont = m_font.get();
+        m_brightnessRevision = m_font->getRevision();
+    }
 
-    //Clear screen buffer and reset cursor position.
-    m_screenBuffer.clear();
-    m_cursor = { 0, 0 };
+    std::vector<uint8_t>& brightness = m_brightness[page];
+    if(brightness.empty())
+    {
+        const sf::Image& atlas = m_font->getImage(page);
+        const uint8_t* atlasPixels = atlas.getPixelsPtr();
+        size_t size = (size_t) atlas.getSize().x * atlas.getSize().y;
 
-    //Reset brush to default.
-    m_active_brush = m_default_brush;
+        brightness.resize(size);
+        for(size_t i = 0; i < size; i++)
+            brightness[i] = (atlasPixels[i * 4] + atlasPixels[i * 4 + 1] + atlasPixels[i * 4 + 2]) / 3;
+    }
+
+    return brightness.data();
 }
 
-void seag::Window::display()
+void seag::impl::blendSpan(uint8_t* pixels, const uint8_t* coverage, size_t count, sf::Color color)
 {
-    sf::Vector2f cellSize = getCellSize();
-    int offset = 0;
+    //out = (color * a + pixel * (255 - a)) / 255, the color alpha is 255 so the pixel alpha follows the alpha blending.
+    size_t i = 0;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i source = _mm_setr_epi16(color.r, color.g, color.b, 255, color.r, color.g, color.b, 255);
+
+    for(; i + 4 <= count; i += 4)
+    {
+        uint32_t alphas;
+        std::memcpy(&alphas, coverage + i, 4);
+        if(alphas == 0)
+            continue;
 
-    for(auto &[y,value] : m_screenBuffer)
+        //Spread the coverage of each pixel over its four channels (two pixels per register).
+        __m128i alpha = _mm_cvtsi32_si128(alphas);
+        alpha = _mm_unpacklo_epi8(alpha, alpha);
+        alpha = _mm_unpacklo_epi16(alpha, alpha);
+        __m128i alphaLow = _mm_unpacklo_epi8(alpha, zero);
+        __m128i alphaHigh = _mm_unpackhi_epi8(alpha, zero);
+
+        __m128i destination = _mm_loadu_si128((const __m128i*) (pixels + i * 4));
+        __m128i low = _mm_unpacklo_epi8(destination, zero);
+        __m128i high = _mm_unpackhi_epi8(destination, zero);
+
+        low = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(source, alphaLow), _mm_mullo_epi16(low, _mm_sub_epi16(full, alphaLow))), round);
+        high = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(source, alphaHigh), _mm_mullo_epi16(high, _mm_sub_epi16(full, alphaHigh))), round);
+
+        //Divide by 255: (v + (v >> 8)) >> 8.
+        low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+        high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+        _mm_storeu_si128((__m128i*) (pixels + i * 4), _mm_packus_epi16(low, high));
+    }
+#endif
+
+    const uint8_t channels[4] = { color.r, color.g, color.b, 255 };
+
+    for(; i < count; i++)
     {
-        for(auto &[x,bufferChar] : value)
+        uint32_t a = coverage[i];
+        if(a == 0)
+            continue;
+
+        for(int c = 0; c < 4; c++)
         {
-            sf::Vector2f pos = { x * cellSize.x, y * cellSize.y };
-            impl::Glyph glyph = m_font->getGlyph(bufferChar.code);
+            uint32_t v = channels[c] * a + pixels[i * 4 + c] * (255 - a) + 128;
+            pixels[i * 4 + c] = (v + (v >> 8)) >> 8;
+        }
+    }
+}
 
-            sf::RectangleShape quad;
-            float scale = (cellSize.x / (float) m_font->getGlyphSize())*2;
-            quad.setSize({ glyph.size.x * scale, glyph.size.y * scale });
-            quad.setTexture(&m_font->getTexture());
-            quad.setTextureRect({ glyph.coords.x + glyph.origin.x, glyph.coords.y + glyph.origin.y, (int) glyph.size.x, (int) glyph.size.y });
-            quad.setFillColor(bufferChar.brush.foregroundColor);
+seag::Recorder::Recorder()
+    : m_compress(true),
+    m_columns(0),
+    m_rows(0),
+    m_frameCount(0),
+    m_framesSinceKeyframe(0),
+    m_stop(false),
+    m_writtenBytes(0)
+{
+}
 
-            sf::Vector2f quadPos = { 
-                pos.x + cellSize.x/2 - quad.getGlobalBounds().width/2,
-                pos.y + glyph.origin.y*scale
-            };
-            quad.setPosition(quadPos);
-
-            sf::RectangleShape backgroundQuad;
-            backgroundQuad.setSize(cellSize);
-            backgroundQuad.setPosition(pos);
-            backgroundQuad.setFillColor(bufferChar.brush.backgroundColor);
-
-            m_window.draw(backgroundQuad);
-            
-            m_shader.setUniform("windowBackground", sf::Glsl::Vec4(m_default_brush.backgroundColor));
-            m_shader.setUniform("foreground", sf::Glsl::Vec4(bufferChar.brush.foregroundColor));
-            m_shader.setUniform("background", sf::Glsl::Vec4(bufferChar.brush.backgroundColor));
-            // m_shader.setUniform("bold", bufferChar.brush.bold);
-            m_shader.setUniform("italic", bufferChar.brush.italic);
-
-            //Italic characters are handled in vertex shader.
-            m_window.draw(quad, &m_shader);
-
-            //If character is bold, we draw it again twice with a 1px offset
-            if(bufferChar.brush.bold)
+seag::Recorder::~Recorder()
+{
+    stop();
+}
+
+bool seag::Recorder::start(const std::string& path, bool compress)
+{
+    stop();
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if(!m_file)
+    {
+        SEAG_ERROR_LOG("Failed to open recording file " + path);
+        return false;
+    }
+
+    uint32_t version = SEAG_RECORDING_VERSION;
+    m_file.write(SEAG_RECORDING_MAGIC, 4);
+    m_file.write((const char*) &version, sizeof(version));
+
+    m_compress = compress;
+    m_previous.clear();
+    m_columns = 0;
+    m_rows = 0;
+    m_brushIds.clear();
+    m_consoleBrushes.clear();
+    m_frameCount = 0;
+    m_framesSinceKeyframe = 0;
+    m_writtenBytes = 8;
+    m_stop = false;
+    m_clock.restart();
+
+    m_writer = std::thread(&Recorder::writeLoop, this);
+    return true;
+}
+
+void seag::Recorder::stop()
+{
+    if(!m_writer.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    m_writer.join();
+
+    m_file.close();
+}
+
+bool seag::Recorder::isRecording()
+{
+    return m_writer.joinable();
+}
+
+void seag::Recorder::capture(Console& console)
+{
+    if(!isRecording())
+        return;
+
+    impl::ScreenBufferView view = console.getScreenBuffer();
+
+    //A keyframe holds all cells and starts a new list of brushes, so playback can start from any of them.
+    bool keyframe = m_frameCount == 0 || view.columns != m_columns || view.rows != m_rows || m_framesSinceKeyframe >= SEAG_RECORDING_KEYFRAME_INTERVAL;
+    if(keyframe)
+    {
+        m_columns = view.columns;
+        m_rows = view.rows;
+        m_previous.assign((size_t) m_columns * m_rows, impl::RecordedCell{ 0, 0 });
+        m_brushIds.clear();
+        m_framesSinceKeyframe = 0;
+    }
+
+    //Console brush ids are only mapped for this capture (the console may drop unused brushes between two captures).
+    if(m_consoleBrushes.size() < view.brushes->getCount())
+        m_consoleBrushes.resize(view.brushes->getCount(), 0);
+
+    std::vector<uint8_t> definitions, cells, run;
+    uint32_t skipped = 0;
+
+    for(uint32_t y = 0; y < m_rows; y++)
+    {
+        const impl::BufferCharacter* row = view.getRow(y);
+
+        for(uint32_t x = 0; x < m_columns; x++)
+        {
+            impl::RecordedCell cell = { row[x].code, getRecordedBrush(*view.brushes, row[x].brush, definitions) };
+            impl::RecordedCell& previous = m_previous[(size_t) y * m_columns + x];
+
+            //Delta frames have runs of changed cells after a number of unchanged ones.
+            if(!keyframe && cell.code == previous.code && cell.brush == previous.brush)
             {
-                for(int i = 1; i < 3; i++)
+                if(!run.empty())
                 {
-                    quad.setPosition(quad.getPosition() + sf::Vector2f(1, 0));
-                    m_window.draw(quad, &m_shader);
+                    cells.insert(cells.end(), run.begin(), run.end());
+                    run.clear();
                 }
+                skipped++;
+                continue;
+            }
+
+            if(!keyframe && run.empty())
+            {
+                impl::writeVarint(cells, skipped);
+                skipped = 0;
+
+                //The run length is written in front of its cells once it ends.
+                run.push_back(0);
             }
+
+            std::vector<uint8_t>& output = keyframe ? cells : run;
+            impl::writeVarint(output, cell.code);
+            impl::writeVarint(output, cell.brush);
+            if(!keyframe)
+                run[0]++;
+
+            //A run is limited to 127 cells so its length fits in one varint byte.
+            if(!keyframe && run[0] == 127)
+            {
+                cells.insert(cells.end(), run.begin(), run.end());
+                run.clear();
+            }
+
+            previous = cell;
         }
     }
 
-    m_window.display();
+    if(!keyframe)
+    {
+        cells.insert(cells.end(), run.begin(), run.end());
+
+        //A run of 0 cells ends the frame.
+        impl::writeVarint(cells, 0);
+        impl::writeVarint(cells, 0);
+    }
+
+    //Frame: type, delay since the previous frame, size (keyframes), new brushes, then cells.
+    std::vector<uint8_t> frame;
+    frame.reserve(definitions.size() + cells.size() + 16);
+    frame.push_back(keyframe ? 0 : 1);
+    impl::writeVarint(frame, m_clock.restart().asMicroseconds());
+    if(keyframe)
+    {
+        impl::writeVarint(frame, m_columns);
+        impl::writeVarint(frame, m_rows);
+    }
+    impl::writeVarint(frame, definitions.size() / 9);
+    frame.insert(frame.end(), definitions.begin(), definitions.end());
+    frame.insert(frame.end(), cells.begin(), cells.end());
+
+    m_frameCount++;
+    m_framesSinceKeyframe++;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(frame));
+    }
+    m_condition.notify_all();
 }
 
-void seag::Window::close()
+uint64_t seag::Recorder::getFrameCount()
 {
-    m_window.close();
-}
\ No newline at end of file
+    return m_frameCount;
+}
+
+uint64_t seag::Recorder::getWrittenBytes()
+{
+    return m_writtenBytes;
+}
+
+uint32_t seag::Recorder::getRecordedBrush(const impl::BrushTable& brushes, uint16_t id, std::vector<uint8_t>& definitions)
+{
+    uint64_t& mapped = m_consoleBrushes[id];
+    if((mapped >> 32) == m_frameCount + 1)
+        return mapped & 0xFFFFFFFF;
+
+    const Brush& brush = brushes.get(id);
+    auto it = m_brushIds.find(brush);
+    if(it == m_brushIds.end())
+    {
+        //New brushes are defined in the frame that first uses them: foreground, background and styles.
+        it = m_brushIds.emplace(brush, m_brushIds.size()).first;
+        uint8_t definition[9] = {
+            brush.foregroundColor.r, brush.foregroundColor.g, brush.foregroundColor.b, brush.foregroundColor.a,
+            brush.backgroundColor.r, brush.backgroundColor.g, brush.backgroundColor.b, brush.backgroundColor.a,
+            (uint8_t) ((brush.bold ? 1 : 0) | (brush.italic ? 2 : 0))
+        };
+        definitions.insert(definitions.end(), definition, definition + 9);
+    }
+
+    mapped = (m_frameCount + 1) << 32 | it->second;
+    return it->second;
+}
+
+void seag::Recorder::writeLoop()
+{
+    std::vector<uint8_t> compressed;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(true)
+    {
+        m_condition.wait(lock, [this]() { return !m_queue.empty() || m_stop; });
+
+        //Queued frames are still written when stopping.
+        if(m_queue.empty())
+            break;
+
+        std::vector<uint8_t> frame = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+
+        //Frame record: stored size, decompressed size (0 if stored as is), then the bytes.
+        const std::vector<uint8_t>* stored = &frame;
+        uint32_t decompressedSize = 0;
+
+        if(m_compress)
+        {
+            impl::compressLz(frame.data(), frame.size(), compressed);
+            if(compressed.size() < frame.size())
+            {
+                stored = &compressed;
+                decompressedSize = frame.size();
+            }
+        }
+
+        uint32_t storedSize = stored->size();
+        m_file.write((const char*) &storedSize, sizeof(storedSize));
+        m_file.write((const char*) &decompressedSize, sizeof(decompressedSize));
+        m_file.write((const char*) stored->data(), storedSize);
+        m_writtenBytes += 8 + storedSize;
+
+        lock.lock();
+    }
+
+    m_file.flush();
+}
+
+seag::Player::Player()
+    : m_offset(0),
+    m_columns(0),
+    m_rows(0),
+    m_frameIndex(0)
+{
+}
+
+bool seag::Player::open(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+    {
+        SEAG_ERROR_LOG("Failed to open recording file " + path);
+        return false;
+    }
+
+    m_data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    impl::ByteReader reader = { m_data.data(), m_data.size(), 4, false };
+    uint32_t version = reader.readUint32();
+    if(reader.failed || std::memcmp(m_data.data(), SEAG_RECORDING_MAGIC, 4) != 0 || version != SEAG_RECORDING_VERSION)
+    {
+        SEAG_ERROR_LOG("Invalid recording file " + path);
+        m_data.clear();
+        return false;
+    }
+
+    rewind();
+    return true;
+}
+
+void seag::Player::rewind()
+{
+    m_offset = 8;
+    m_brushes.clear();
+    m_columns = 0;
+    m_rows = 0;
+    m_frameIndex = 0;
+    m_frameDelay = sf::Time::Zero;
+}
+
+bool seag::Player::nextFrame(Console& console)
+{
+    if(m_offset >= m_data.size())
+        return false;
+
+    impl::ByteReader record = { m_data.data(), m_data.size(), m_offset, false };
+    uint32_t storedSize = record.readUint32();
+    uint32_t decompressedSize = record.readUint32();
+    if(record.failed || storedSize > m_data.size() - record.offset)
+    {
+        SEAG_ERROR_LOG("Truncated frame in recording.");
+        m_offset = m_data.size();
+        return false;
+    }
+
+    const uint8_t* bytes = m_data.data() + record.offset;
+    size_t size = storedSize;
+    m_offset = record.offset + storedSize;
+
+    if(decompressedSize > 0)
+    {
+        if(!impl::decompressLz(bytes, storedSize, decompressedSize, m_frame))
+        {
+            SEAG_ERROR_LOG("Invalid compressed frame in recording.");
+            return false;
+        }
+        bytes = m_frame.data();
+        size = decompressedSize;
+    }
+
+    impl::ByteReader reader = { bytes, size, 0, false };
+    bool keyframe = reader.readByte() == 0;
+    m_frameDelay = sf::microseconds(reader.readVarint());
+
+    if(keyframe)
+    {
+        m_columns = reader.readVarint();
+        m_rows = reader.readVarint();
+        m_brushes.clear();
+
+        if(console.getColumns() != m_columns || console.getRows() != m_rows)
+            console.resize(m_columns, m_rows);
+    }
+    else if(m_columns == 0)
+    {
+        SEAG_ERROR_LOG("Recording does not start with a keyframe.");
+        return false;
+    }
+
+    for(uint64_t count = reader.readVarint(); count > 0 && !reader.failed; count--)
+    {
+        //Bytes are read one by one (the evaluation order of function arguments is unspecified).
+        uint8_t definition[9];
+        for(uint8_t& byte : definition)
+            byte = reader.readByte();
+
+        Brush brush;
+        brush.foregroundColor = sf::Color(definition[0], definition[1], definition[2], definition[3]);
+        brush.backgroundColor = sf::Color(definition[4], definition[5], definition[6], definition[7]);
+        uint8_t styles = definition[8];
+        brush.bold = styles & 1;
+        brush.italic = styles & 2;
+        m_brushes.push_back(brush);
+    }
+
+    uint32_t count = m_columns * m_rows;
+    if(keyframe)
+    {
+        for(uint32_t i = 0; i < count && !reader.failed; i++)
+            readCell(reader, console, i);
+    }
+    else
+    {
+        //Runs of changed cells after a number of unchanged ones, until an empty run.
+        for(uint64_t index = 0; !reader.failed;)
+        {
+            index += reader.readVarint();
+            uint64_t length = reader.readVarint();
+            if(length == 0)
+                break;
+
+            for(; length > 0 && !reader.failed; length--, index++)
+                readCell(reader, console, index);
+        }
+    }
+
+    if(reader.failed)
+    {
+        SEAG_ERROR_LOG("Invalid frame in recording.");
+        return false;
+    }
+
+    m_frameIndex++;
+    return true;
+}
+
+uint64_t seag::Player::getFrame()
+{
+    return m_frameIndex;
+}
+
+sf::Time seag::Player::getFrameDelay()
+{
+    return m_frameDelay;
+}
+
+bool seag::Player::readCell(impl::ByteReader& reader, Console& console, uint32_t index)
+{
+    char32_t code = reader.readVarint();
+    uint64_t brush = reader.readVarint();
+
+    if(reader.failed || index >= m_columns * m_rows || brush >= m_brushes.size())
+    {
+        reader.failed = true;
+        return false;
+    }
+
+    console.setCharacter(index % m_columns, index / m_columns, code, m_brushes[brush]);
+    return true;
+}
@@ -12,9 +12,31 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <locale>
 #include <codecvt>
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <iomanip>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <list>
+#include <limits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include <vector>
+#include <stdexcept>
 
 #include <SFML/Graphics.hpp>
 
@@ -28,6 +50,41 @@
 /* Define glyph rendering modifiers. */
 #define SEAG_LINE_PADDING 0
 #define SEAG_FONT_KERNING 1
+#define SEAG_ITALIC_SKEW 0.3f
+
+/* Define font loading parameters (atlas pixels above which glyphs are scanned by several threads, metrics cache header). */
+#define SEAG_FONT_THREADING_THRESHOLD (256 * 256)
+#define SEAG_FONT_CACHE_MAGIC "SEAG"
+#define SEAG_FONT_CACHE_VERSION 3
+
+/* Define the width and maximum height of the atlas pages holding pre-baked bold and italic glyphs. */
+#define SEAG_FONT_PAGE_SIZE 2048
+
+/* Define the size of the pages of fonts rasterized from TrueType files, their default memory budget and the baseline position (fraction of the glyph size). */
+#define SEAG_FONT_DYNAMIC_PAGE_SIZE 1024
+#define SEAG_FONT_DYNAMIC_BUDGET (16 * 1024 * 1024)
+#define SEAG_FONT_BASELINE 0.8f
+
+/* Define the width of the grid renderer glyph metrics texture (3 texels per glyph). */
+#define SEAG_GRID_METRICS_WIDTH 1024
+
+/* Define the number of brushes allocated at once by a brush table (cells store 16-bit brush ids). */
+#define SEAG_BRUSH_CHUNK_SIZE 256
+
+/* Define the recording file header and the number of frames between two keyframes (delta frames otherwise). */
+#define SEAG_RECORDING_MAGIC "SREC"
+#define SEAG_RECORDING_VERSION 1
+#define SEAG_RECORDING_KEYFRAME_INTERVAL 600
+
+/* Define the longest sleep of Window::run between two event polls while waiting for a timer or an update step (milliseconds), and the most update steps run at once. */
+#define SEAG_IDLE_POLL_INTERVAL 10
+#define SEAG_MAX_UPDATE_STEPS 8
+
+/* Define the number of cells on each side of the chunks of a world. */
+#define SEAG_WORLD_CHUNK_SIZE 64
+
+/* Define the character drawn in place of characters missing from the font. */
+#define SEAG_FALLBACK_CHARACTER U'?'
 
 /* Define tag characters for text style. */
 #define SEAG_STYLE '#'
@@ -49,38 +106,109 @@ namespace seag
         bool italic;
     };
 
+    bool operator==(const Brush& a, const Brush& b); /* Compare colors and styles of two brushes. */
+    bool operator!=(const Brush& a, const Brush& b); /* Compare colors and styles of two brushes. */
+
+    /* Counters and timings of a displayed frame (see Window::getStats). */
+    struct FrameStats
+    {
+        sf::Time frameTime; /* Time between the end of the previous frame and the end of this one. */
+        sf::Time printTime; /* Time spent in print since the previous frame (zero unless print timing is enabled, see Console::setPrintTiming). */
+        sf::Time buildTime; /* Time spent building the geometry of changed rows. */
+        sf::Time submitTime; /* Time spent drawing to the canvas and the window. */
+        sf::Time presentTime; /* Time spent in sf::RenderWindow::display (includes vsync). */
+        uint32_t printCalls;
+        uint32_t drawCalls;
+        uint32_t rowsDrawn;
+        uint32_t cellsDrawn;
+        uint32_t chunksDrawn; /* World chunks in the view. */
+        uint32_t chunksBuilt; /* World chunks whose geometry was built again. */
+        uint32_t uniformUpdates;
+        size_t bufferBytes; /* Bytes held by the screen buffer. */
+        size_t glyphBytes; /* Bytes held by the glyph table of the font. */
+    };
+
+    class Font;
+
     /* Internal structures and classes. */
     namespace impl
     {
+        /* Colors are read from the vertices, bold and italic glyphs are pre-baked in the atlas pages. */
         const std::string vertexShader = \
-            "uniform vec4 windowBackground;" \
-            "uniform vec4 foreground;" \
-            "uniform vec4 background;" \
-            "uniform bool italic;" \
             "void main()" \
             "{" \
-                "vec4 pos = gl_Vertex;" \
-                "if(italic) pos.x -= pos.y * 0.3 - 0.0;" \
-                "pos = gl_ModelViewProjectionMatrix * pos;" \
-                "gl_Position = pos;" \
+                "gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;" \
                 "gl_TexCoord[0] = gl_TextureMatrix[0] * gl_MultiTexCoord0;" \
                 "gl_FrontColor = gl_Color;" \
             "}";
 
+        /* The atlas brightness is used as the coverage of the foreground color (vertex color). */
         const std::string fragmentShader = \
             "uniform sampler2D texture;" \
-            "uniform vec4 windowBackground;" \
-            "uniform vec4 foreground;" \
-            "uniform vec4 background;" \
-            "uniform bool italic;" \
             "void main()" \
             "{" \
                 "vec4 pixel = texture2D(texture, gl_TexCoord[0].xy);" \
                 "float t = (pixel.r + pixel.g + pixel.b)/3.0;" \
-                "vec4 targetBackground = background;" \
-                "vec4 targetForeground = foreground;" \
-                "if(windowBackground == background) targetBackground.a = 0.0;" \
-                "vec4 color = mix(targetBackground, targetForeground, t);" \
+                "gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * t);" \
+            "}";
+
+        /* Grid renderer quad covers the screen, texture coordinates are cell positions. */
+        const std::string gridVertexShader = \
+            "varying vec2 position;" \
+            "void main()" \
+            "{" \
+                "gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;" \
+                "position = gl_MultiTexCoord0.xy;" \
+            "}";
+
+        /* Read the cell of the pixel, then its glyph metrics, then the atlas (samplePage is generated for the pages of the font). */
+        const std::string gridFragmentShader = \
+            "uniform sampler2D cells;" \
+            "uniform vec2 gridSize;" \
+            "uniform sampler2D metrics;" \
+            "uniform vec2 metricsSize;" \
+            "uniform vec2 cellSize;" \
+            "uniform float scale;" \
+            "uniform vec4 background;" \
+            "varying vec2 position;" \
+            "float readShort(vec2 bytes)" \
+            "{" \
+                "return floor(bytes.x * 255.0 + 0.5) + floor(bytes.y * 255.0 + 0.5) * 256.0;" \
+            "}" \
+            "vec4 readCell(vec2 cell, float texel)" \
+            "{" \
+                "return texture2D(cells, (vec2(cell.x * 3.0 + texel, cell.y) + 0.5) / vec2(gridSize.x * 3.0, gridSize.y));" \
+            "}" \
+            "vec4 readMetrics(float texel)" \
+            "{" \
+                "float y = floor(texel / metricsSize.x);" \
+                "return texture2D(metrics, (vec2(texel - y * metricsSize.x, y) + 0.5) / metricsSize);" \
+            "}" \
+            "void main()" \
+            "{" \
+                "vec2 cell = floor(position);" \
+                "vec2 pixel = (position - cell) * cellSize;" \
+                "vec4 data = readCell(cell, 0.0);" \
+                "float index = readShort(data.rg) + floor(data.b * 255.0 + 0.5) * 65536.0;" \
+                "vec4 color = background;" \
+                "if(index > 0.0)" \
+                "{" \
+                    "vec4 foreground = readCell(cell, 1.0);" \
+                    "vec4 cellBackground = readCell(cell, 2.0);" \
+                    "color.rgb = mix(color.rgb, cellBackground.rgb, cellBackground.a);" \
+                    "vec4 texRect = readMetrics((index - 1.0) * 3.0);" \
+                    "vec4 size = readMetrics((index - 1.0) * 3.0 + 1.0);" \
+                    "vec4 placement = readMetrics((index - 1.0) * 3.0 + 2.0);" \
+                    "vec2 glyphSize = vec2(readShort(size.rg), readShort(size.ba));" \
+                    "vec2 origin = vec2(cellSize.x / 2.0 - glyphSize.x * scale / 2.0, readShort(placement.rg) * scale);" \
+                    "vec2 local = (pixel - origin) / scale;" \
+                    "if(local.x >= 0.0 && local.y >= 0.0 && local.x < glyphSize.x && local.y < glyphSize.y)" \
+                    "{" \
+                        "vec4 glyph = samplePage(readShort(placement.ba), vec2(readShort(texRect.rg), readShort(texRect.ba)) + floor(local) + 0.5);" \
+                        "float t = (glyph.r + glyph.g + glyph.b)/3.0;" \
+                        "color.rgb = mix(color.rgb, foreground.rgb, foreground.a * t);" \
+                    "}" \
+                "}" \
                 "gl_FragColor = color;" \
             "}";
 
@@ -90,75 +218,656 @@ namespace seag
             sf::Vector2i coords;
             sf::Vector2i origin;
             sf::Vector2f size;
+            uint32_t page; /* Atlas page holding the glyph (0 is the atlas image). */
         };
 
-        /* Represent a character on the screen with its value (unicode) and its brush (color, style). */
+        /* Glyph metrics of an atlas generated at build time (see atlas_generator.cpp), converted to Glyph when the font is created. */
+        struct AtlasGlyph
+        {
+            int16_t x;
+            int16_t y;
+            int16_t originX;
+            int16_t originY;
+            float width;
+            float height;
+        };
+
+        /* Glyph of a dynamic font, rasterized in a slot of its pages. */
+        struct DynamicGlyph
+        {
+            uint32_t slot;
+            uint64_t lastFrame; /* Last frame the glyph was used (see Font::update). */
+            std::list<uint64_t>::iterator lru; /* Position in the list of glyphs by last use. */
+        };
+
+        /* Glyph of a dynamic font waiting to be copied from the TrueType font texture to its slot. */
+        struct PendingGlyph
+        {
+            uint32_t slot;
+            sf::IntRect textureRect;
+            bool italic;
+        };
+
+        /* Sparse table of glyphs indexed by unicode character (direct lookup for 0-255, pages of 256 characters above). */
+        class GlyphTable
+        {
+            public:
+                GlyphTable(); /* Create an empty table. */
+
+                void insert(char32_t character, const Glyph& glyph); /* Add or replace the glyph of a character. */
+                const Glyph* find(char32_t character) const; /* Get the glyph of a character (nullptr if missing). */
+                const Glyph& at(size_t index) const; /* Get a glyph by insertion index. */
+                size_t getIndex(const Glyph* glyph) const; /* Get the insertion index of a glyph returned by find(). */
+                void clear(); /* Remove all glyphs. */
+
+                size_t getCount() const; /* Get the number of glyphs in the table. */
+                size_t getMemoryUsage() const; /* Get the number of bytes used by the table. */
+
+            private:
+                std::vector<Glyph> m_glyphs; /* Glyphs in insertion order. */
+                uint32_t m_latin[256]; /* Index + 1 in m_glyphs of characters 0-255 (0 if missing). */
+                std::vector<uint32_t> m_pageTable; /* Page + 1 in m_pages of each block of 256 characters (0 if missing). */
+                std::vector<uint32_t> m_pages; /* Index + 1 in m_glyphs of characters in allocated pages (0 if missing). */
+        };
+
+        /* Find the first and last non-empty pixels in a row of RGBA pixels (empty is opaque black or transparent). */
+        bool findPixels(const uint8_t* pixels, int count, int& first, int& last);
+
+        /* Determine if data starts with a TrueType, OpenType or font collection header. */
+        bool isTrueType(const uint8_t* data, size_t size);
+
+        /* Hash a block of pixels (used to key the font metrics cache). */
+        uint64_t hashPixels(const uint8_t* pixels, size_t size);
+
+        /* Decode the UTF-8 character at str (U+FFFD if invalid) and return a pointer to the next one. */
+        const char* decodeUtf8(const char* str, const char* end, char32_t& character);
+
+        /* Append a character encoded as UTF-8. */
+        void encodeUtf8(std::string& str, char32_t character);
+
+        /* Determine if a character takes two columns in a terminal (CJK and emoji). */
+        bool isWideCharacter(char32_t character);
+
+        /* Count the leading printable ASCII characters (0x20-0x7F) of a string, 16 bytes at a time with SSE2. */
+        size_t countPrintableAscii(const char* str, const char* end);
+
+        /* Append an unsigned integer in groups of 7 bits (LEB128). */
+        void writeVarint(std::vector<uint8_t>& data, uint64_t value);
+
+        /* Read bytes of a buffer, reading past the end sets failed and returns zeros. */
+        struct ByteReader
+        {
+            const uint8_t* data;
+            size_t size;
+            size_t offset;
+            bool failed;
+
+            uint8_t readByte(); /* Read one byte. */
+            uint32_t readUint32(); /* Read a little-endian 32 bits integer. */
+            uint64_t readVarint(); /* Read an integer written by writeVarint. */
+        };
+
+        /* Compress bytes with LZ77 (runs of literals and matches up to 65535 bytes back). */
+        void compressLz(const uint8_t* data, size_t size, std::vector<uint8_t>& compressed);
+
+        /* Decompress bytes written by compressLz (false if the data is invalid or does not have the expected size). */
+        bool decompressLz(const uint8_t* data, size_t size, size_t decompressedSize, std::vector<uint8_t>& decompressed);
+
+        /* Append characters to a UTF-32 string (decoded if UTF-8). */
+        void appendCharacters(std::u32string& str, const char32_t* begin, const char32_t* end);
+        void appendCharacters(std::u32string& str, const char* begin, const char* end);
+
+        /* Style changes read from markup tags, applied in this order: reset, toggles, colors. */
+        struct StyleChange
+        {
+            enum Flags : uint8_t
+            {
+                Reset = 1 << 0,
+                ToggleBold = 1 << 1,
+                ToggleItalic = 1 << 2,
+                Foreground = 1 << 3,
+                Background = 1 << 4
+            };
+
+            uint8_t flags;
+            sf::Color foregroundColor;
+            sf::Color backgroundColor;
+        };
+
+        /* Combine a style change with the one of a following tag. */
+        void combineStyle(StyleChange& change, const StyleChange& next);
+
+        /* Decode a color from hexadecimal digits (RRGGBB), return false if a digit is invalid. */
+        template<typename CharT>
+        bool parseHexColor(const CharT* digits, sf::Color& color);
+
+        /* Split markup into text (handler.text(begin, end)) and style tags (handler.style(change)) without allocating. */
+        template<typename CharT, typename Handler>
+        void parseMarkup(const CharT* str, size_t length, Handler& handler);
+
+        /* Blend a color into a span of RGBA pixels with a coverage (0-255) per pixel. */
+        void blendSpan(uint8_t* pixels, const uint8_t* coverage, size_t count, sf::Color color);
+
+        /* Coverage (0-255) of a glyph drawn in a cell, the bitmap is placed at (left, top) from the top left corner of the cell. */
+        struct GlyphBitmap
+        {
+            int left;
+            int top;
+            int width;
+            int height;
+            std::vector<uint8_t> coverage;
+        };
+
+        /* Represent a character on the screen with its value (unicode) and the id of its brush in the console brush table. */
         struct BufferCharacter
+        {
+            char32_t code;
+            uint16_t brush;
+        };
+
+        /* Character of a recorded frame, the brush is an id in the recorded brushes since the last keyframe. */
+        struct RecordedCell
+        {
+            char32_t code;
+            uint32_t brush;
+        };
+
+        /* Character with its brush resolved from the brush table (see Console::getCharacter). */
+        struct ResolvedCharacter
         {
             char32_t code;
             Brush brush;
         };
+
+        /* Hash the colors and styles of a brush. */
+        struct BrushHash
+        {
+            size_t operator()(const Brush& brush) const;
+        };
+
+        /* Brushes interned by id, cells store the id (id 0 is Brush(), the brush of empty cells). */
+        class BrushTable
+        {
+            /* Brushes are stored in chunks that never move, so ids on a screen can be read while new brushes are added by another thread. */
+            public:
+                BrushTable(); /* Create a table with the empty cell brush. */
+
+                bool intern(const Brush& brush, uint16_t& id); /* Get the id of a brush, added if missing (false if the table is full). */
+                const Brush& get(uint16_t id) const; /* Get a brush by id (no bounds check). */
+                uint32_t getCount() const; /* Get the number of brushes in the table. */
+                uint32_t getRevision() const; /* Get the number of compactions (ids interned before one may have changed). */
+                void compact(const std::vector<uint8_t>& used, std::vector<uint16_t>& remap); /* Keep the used brushes only (used[id] != 0), remap[id] is the new id of a kept brush. */
+                size_t getMemoryUsage() const; /* Get the number of bytes used by the brushes. */
+
+            private:
+                std::unique_ptr<Brush[]> m_chunks[65536 / SEAG_BRUSH_CHUNK_SIZE];
+                std::unordered_map<Brush, uint16_t, BrushHash> m_ids;
+                uint32_t m_count;
+                uint32_t m_revision;
+                Brush m_lastBrush; /* Last interned brush (printing usually keeps the same one). */
+                uint16_t m_lastId;
+        };
+
+        /* Read-only file mapped in memory (read into memory if it cannot be mapped). */
+        class MappedFile
+        {
+            public:
+                MappedFile();
+                ~MappedFile();
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+
+                bool open(const std::string& path); /* Map a file (the previous one is closed), return false if it cannot be read. */
+                void close(); /* Unmap the file. */
+                const uint8_t* getData() const; /* Get the content of the file (valid until it is closed). */
+                size_t getSize() const; /* Get the size of the file in bytes. */
+
+            private:
+                const uint8_t* m_data;
+                size_t m_size;
+                bool m_mapped; /* The data is mapped (read in m_buffer otherwise). */
+                std::vector<uint8_t> m_buffer;
+        };
+
+        /* Process-wide cache of fonts and shaders, resources are shared by their users and freed with the last one (weak references). */
+        class Registry
+        {
+            public:
+                static Registry& get(); /* Get the registry of the process. */
+
+                std::shared_ptr<Font> getFont(const std::string& key, const std::function<Font*()>& load); /* Get a font by key, loaded if it is not used anymore (loads are serialized). */
+                std::shared_ptr<sf::Shader> getShader(const std::string& vertex, const std::string& fragment); /* Get a shader compiled from sources (nullptr if it does not compile). */
+                size_t getFontCount(); /* Get the number of fonts in use. */
+
+            private:
+                std::mutex m_mutex;
+                std::unordered_map<std::string, std::weak_ptr<Font>> m_fonts;
+                std::unordered_map<std::string, std::weak_ptr<sf::Shader>> m_shaders;
+        };
+
+        /* Append a quad (two triangles) to a vertex array. */
+        void appendQuad(sf::VertexArray& vertices, const sf::FloatRect& quad, sf::Color color, const sf::FloatRect& textureRect);
+
+        /* Get the key of a styled character (rasterizer glyph bitmaps and glyphs of dynamic fonts). */
+        uint64_t getBitmapKey(char32_t code, bool bold, bool italic);
+
+        /* Clip a copy of a rectangle to a position so it fits in both grids (false if nothing is left to copy). */
+        bool clipCopy(sf::IntRect& source, sf::Vector2i& destination, sf::Vector2u sourceSize, sf::Vector2u destinationSize);
+
+        /* Determine if two views show the same area at the same place of the window (center, size, rotation and viewport). */
+        bool isSameView(const sf::View& a, const sf::View& b);
+
+        /* Copy the non-empty characters (code != 0) of a row over another (SSE2 masked copy), true if a character changed. */
+        bool blitRow(BufferCharacter* destination, const BufferCharacter* source, uint32_t count);
+
+        /* Non-owning view on a rectangle of characters, brush ids are read from brushes (ids are copied as is if nullptr). */
+        struct ScreenBufferView
+        {
+            /* Row y starts at cells + ((first + y) % ring) * stride, so views on the ring of a screen buffer are never reordered (ring is 0 for contiguous rows). */
+            BufferCharacter* cells;
+            uint32_t columns;
+            uint32_t rows;
+            uint32_t stride;
+            const BrushTable* brushes;
+            uint32_t first;
+            uint32_t ring;
+
+            BufferCharacter* getRow(uint32_t y) const; /* Get a pointer to the first character of a row of the view. */
+        };
+
+        /* Dense grid of characters stored row by row (cell (x, y) is at index y * columns + x). */
+        class ScreenBuffer
+        {
+            /* Rows are stored in a ring of rows + scrollback rows, row y of the grid is row y of the view (the view is moved up into the scrollback by the view offset). */
+            public:
+                ScreenBuffer(); /* Create an empty grid. */
+                ScreenBuffer(uint32_t columns, uint32_t rows); /* Create a grid of empty characters. */
+
+                uint32_t getColumns() const; /* Get the number of characters per row. */
+                uint32_t getRows() const; /* Get the number of rows. */
+                bool contains(int64_t x, int64_t y) const; /* Determine if a position is inside the grid. */
+
+                BufferCharacter& at(uint32_t x, uint32_t y); /* Get a character (no bounds check, writes do not mark the row dirty). */
+                const BufferCharacter& at(uint32_t x, uint32_t y) const; /* Get a character (no bounds check). */
+                BufferCharacter* getRow(uint32_t y); /* Get a pointer to the first character of a row (writes do not mark the row dirty). */
+                const BufferCharacter* getRow(uint32_t y) const; /* Get a pointer to the first character of a row. */
+                const BufferCharacter* getAbsoluteRow(uint64_t row) const; /* Get a row by absolute number, counted from the first row ever on screen (nullptr if it is no longer kept). */
+
+                void set(int64_t x, int64_t y, const BufferCharacter& character); /* Change a character and mark its row dirty if it changed (ignored outside of the grid). */
+
+                ScreenBufferView getView(); /* Get a view on the whole grid (O(1), rows are read through the ring). */
+                ScreenBufferView getView(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows); /* Get a view on a rectangle of the grid (clipped to the grid, O(1)). */
+                void copy(const ScreenBufferView& view, uint32_t x, uint32_t y); /* Copy the characters of a view at a position (clipped to the grid, the view may overlap it). */
+                void blit(const ScreenBufferView& view, uint32_t x, uint32_t y); /* Copy the non-empty characters of a view at a position (clipped to the grid, the view must not overlap it). */
+                void fill(const sf::IntRect& rect, const BufferCharacter& character); /* Change all characters of a rectangle (clipped to the grid). */
+
+                void resize(uint32_t columns, uint32_t rows); /* Change the grid size and keep the characters that still fit. */
+                void clear(); /* Reset all characters to empty (code 0), the scrollback is kept. */
+
+                uint32_t getScrollback() const; /* Get the maximum number of rows kept above the screen. */
+                void setScrollback(uint32_t rows); /* Change the maximum number of rows kept above the screen (0 drops rows scrolled off the top). */
+                uint32_t getScrollbackSize() const; /* Get the number of rows currently kept above the screen. */
+                uint64_t getFirstRow() const; /* Get the absolute number of the first row of the screen (number of rows scrolled). */
+                void scroll(uint32_t rows); /* Move the screen content up, rows scrolled off the top go to the scrollback (O(columns) per row, cells are not moved). */
+
+                uint32_t getViewOffset() const; /* Get the number of rows the view is moved up into the scrollback. */
+                void setViewOffset(uint32_t offset); /* Move the view up into the scrollback (clamped to its size, 0 shows the screen). */
+
+                bool isRowDirty(uint32_t y) const; /* Determine if a row differs from its content at the last call to clearDirty() (or was forced to be drawn again). */
+                bool isDirty() const; /* Determine if any row differs from its content at the last call to clearDirty(). */
+                void markRowDirty(uint32_t y); /* Force a row to be drawn again. */
+                void markDirty(); /* Force all rows to be drawn again. */
+                void clearDirty(); /* Mark all rows as drawn (changed rows are kept to be compared with the next frame). */
+
+                void copyDirtyRows(const ScreenBuffer& source); /* Copy the rows changed in another buffer (the whole grid if sizes differ). */
+
+                void markBrushes(std::vector<uint8_t>& used) const; /* Set used[id] for the brush of each cell (scrollback included). */
+                void remapBrushes(const std::vector<uint16_t>& remap); /* Replace the brush id of each cell by remap[id] (rows are not marked dirty). */
+
+                size_t getMemoryUsage() const; /* Get the number of bytes used by the grid. */
+
+            private:
+                /* State of a row since the last call to clearDirty(). */
+                enum RowState : uint8_t
+                {
+                    RowChanged = 1, /* Written, drawn again only if it differs from the drawn row. */
+                    RowForced = 2
+                };
+
+                std::vector<BufferCharacter> m_cells;
+                std::vector<BufferCharacter> m_drawnCells; /* Rows of the screen at the last call to clearDirty(), row y at y * columns. */
+                std::vector<uint8_t> m_dirtyRows;
+                uint32_t m_columns;
+                uint32_t m_rows;
+                uint32_t m_scrollback;
+                uint32_t m_scrollbackSize;
+                uint32_t m_first;
+                uint32_t m_viewOffset;
+                uint64_t m_scrolled;
+
+                size_t getRingIndex(int64_t y) const; /* Get the index in the ring of a row relative to the first row of the screen (negative in the scrollback). */
+                void reorder(std::vector<BufferCharacter>& cells, uint32_t columns, uint32_t rows, uint32_t scrollback) const; /* Copy the scrollback and the screen into a new ring starting at index 0. */
+        };
+
+        /* Geometry of a layer, never changed once built so the render thread can draw it while a new one is built. */
+        struct LayerGeometry
+        {
+            sf::VertexArray backgrounds;
+            std::vector<sf::VertexArray> glyphs; /* Glyph quads of each atlas page. */
+            std::shared_ptr<Font> font; /* Kept while the geometry is drawn. */
+            int fontSize;
+            uint64_t fontEvictions; /* Font::getEvictionCount() when the geometry was built. */
+        };
+
+        /* Layer geometry to draw at an offset in pixels. */
+        struct LayerDraw
+        {
+            std::shared_ptr<const LayerGeometry> geometry;
+            sf::Vector2f offset;
+        };
+
+        /* Geometry of a world chunk, the render thread uploads it to vertex buffers on first draw (the vertex arrays are drawn as is without vertex buffer support). */
+        struct ChunkGeometry
+        {
+            LayerGeometry vertices; /* Built on the main thread, released once uploaded. */
+            sf::VertexBuffer backgrounds;
+            std::vector<sf::VertexBuffer> glyphs; /* Glyph quads of each atlas page. */
+            bool uploaded;
+        };
+
+        /* Characters of a world chunk (row y starts at y * SEAG_WORLD_CHUNK_SIZE). */
+        struct WorldChunk
+        {
+            std::vector<BufferCharacter> cells;
+            bool dirty; /* Characters changed since the geometry was built. */
+            std::shared_ptr<ChunkGeometry> geometry;
+        };
+
+        /* Chunk geometry to draw at an offset in pixels. */
+        struct ChunkDraw
+        {
+            std::shared_ptr<ChunkGeometry> geometry;
+            sf::Vector2f offset;
+        };
+
+        /* Visible chunks of a world, drawn with a transform from the world view to the window view. */
+        struct WorldDraw
+        {
+            sf::Transform transform;
+            std::vector<ChunkDraw> chunks;
+        };
+
+        /* Get the key of a chunk in the chunks of a world. */
+        uint64_t getChunkKey(int32_t x, int32_t y);
+
+        /* Divide rounding toward negative infinity (position of the chunk of a cell). */
+        int64_t floorDivide(int64_t value, int64_t divisor);
+
+        /* Function called by Window::run after an interval. */
+        struct Timer
+        {
+            uint32_t id;
+            sf::Time interval;
+            sf::Time next; /* Time of the next call (on the window clock). */
+            std::function<void()> callback;
+            bool repeat;
+        };
+
+        /* State read while drawing a frame, captured on the thread which prints (see Window::present). */
+        struct FrameState
+        {
+            std::shared_ptr<Font> font; /* Kept while the frame is drawn, even if the window font is changed. */
+            const BrushTable* brushes;
+            int fontSize;
+            sf::Color background;
+            sf::Vector2u size;
+            bool grid; /* Draw with the grid renderer instead of the canvas. */
+            std::vector<LayerDraw> layers; /* Visible layers in z-order. */
+            std::vector<WorldDraw> worlds; /* Chunks of each world in its view. */
+            FrameStats stats;
+        };
+
+        /* Draw a screen buffer in one full-screen pass, cells are uploaded to a data texture and the fragment shader looks up their glyph in the atlas pages. */
+        class GridRenderer
+        {
+            public:
+                GridRenderer();
+
+                void build(const ScreenBuffer& buffer, FrameState& frame); /* Encode the changed rows of a screen buffer (all rows when the grid size or the font changed). */
+                void draw(sf::RenderTarget& target, FrameState& frame); /* Upload the changed rows and draw the grid (one texture update and one quad). */
+
+            private:
+                std::vector<uint8_t> m_cells; /* 3 texels per cell: glyph index + 1 (0 for empty cells), foreground and background colors. */
+                sf::Vector2u m_gridSize;
+                uint32_t m_dirtyBegin;
+                uint32_t m_dirtyEnd;
+                std::shared_ptr<Font> m_font; /* Font of the encoded glyph indices. */
+
+                sf::Texture m_cellsTexture;
+                sf::Texture m_metricsTexture;
+                sf::Shader m_shader;
+                sf::VertexArray m_quad;
+                Font* m_shaderFont; /* Font of the metrics texture and the shader pages. */
+                uint32_t m_shaderPages;
+                uint64_t m_fontRevision; /* Font::getRevision() of the metrics texture. */
+                uint64_t m_fontEvictions; /* Font::getEvictionCount() before all rows were last encoded (evictions during the encode are caught next frame). */
+                bool m_shaderLoaded;
+                sf::Vector2f m_cellSize;
+                sf::Color m_background;
+
+                void loadFont(Font* font, FrameStats& stats); /* Build the metrics texture and the shader sampling the atlas pages of a font. */
+        };
+
+        /* Cursor and brush of a Printer, only read and written while the console applies its commands. */
+        struct PrinterState
+        {
+            sf::Vector2f cursor;
+            Brush brush;
+        };
+
+        /* Command sent by a Printer to a console. */
+        struct PrintCommand
+        {
+            enum Type : uint8_t
+            {
+                Print,
+                PrintUtf32,
+                Cursor,
+                Foreground,
+                Background,
+                Bold,
+                Italic,
+                Reset
+            };
+
+            std::atomic<PrintCommand*> next;
+            std::shared_ptr<PrinterState> state;
+            Type type;
+            std::string text;
+            std::u32string text32;
+            sf::Vector2f cursor;
+            sf::Color color;
+            bool enabled;
+        };
+
+        /* Intrusive lock-free queue, any thread can push and a single thread pops (commands keep the order of each producer). */
+        class PrintQueue
+        {
+            public:
+                PrintQueue();
+                ~PrintQueue(); /* Delete the commands left in the queue. */
+
+                void push(PrintCommand* command); /* Add a command (wait-free, the queue takes ownership). */
+                PrintCommand* pop(); /* Take the oldest command (nullptr if empty or if a push is not finished, the caller owns the command). */
+
+            private:
+                std::atomic<PrintCommand*> m_head;
+                PrintCommand* m_tail;
+                PrintCommand m_stub;
+        };
     }
 
+    class Printer;
+
     /* Used to load and process bitmap font atlas from file or memory. */
     class Font
     {
         public:
-            Font(const std::string& file_path, int glyph_size); /* Create and load a font from a file. */
-            Font(const void* data, size_t size, int glyph_size); /* Create and load a font from a memory address. */
+            Font(const std::string& file_path, int glyph_size, const std::string& cache_path = ""); /* Create and load a font from a file mapped in memory (glyph metrics are cached in cache_path if not empty). */
+            Font(const void* data, size_t size, int glyph_size, const std::string& cache_path = ""); /* Create and load a font from a memory address (glyph metrics are cached in cache_path if not empty). */
+            Font(const uint8_t* bits, uint32_t width, uint32_t height, int glyph_size, const impl::AtlasGlyph* glyphs, size_t glyph_count); /* Create a font from a 1-bit packed atlas and its glyph metrics (generated by atlas_generator, nothing is decoded or scanned). */
+            /* TrueType and OpenType files (detected from their header) are dynamic fonts: glyphs are rasterized on first use into atlas pages, data must be kept while the font is used. */
             ~Font();
 
-            sf::Texture& getTexture(); /* Get the SFML texture of the atlas (used to draw). */
-            sf::Image& getImage(); /* Get the SFML image of the atlas (used to read/write pixels). */
-            impl::Glyph getGlyph(char32_t character); /* Get the glyph data of a unicode character. */
+            static std::shared_ptr<Font> load(const std::string& file_path, int glyph_size, const std::string& cache_path = ""); /* Get a font shared by its users, loaded once per file path and glyph size while it is used. */
+            static std::shared_ptr<Font> load(const void* data, size_t size, int glyph_size, const std::string& cache_path = ""); /* Get a shared font from memory, fonts are told apart by a hash of the data and the glyph size. */
+            static std::shared_ptr<Font> getDefault(); /* Get the shared embedded CP437 font. */
+
+            sf::Texture& getTexture(uint32_t page = 0); /* Get the SFML texture of an atlas page (used to draw, created on first call). */
+            sf::Image& getImage(uint32_t page = 0); /* Get the SFML image of an atlas page, 0 is the atlas and other pages hold bold and italic glyphs. */
+            uint32_t getPageCount(); /* Get the number of atlas pages. */
+            const impl::Glyph& getGlyph(char32_t character); /* Get the glyph data of a unicode character (fallback glyph if missing). */
+            const impl::Glyph& getGlyph(char32_t character, bool bold, bool italic); /* Get the glyph data of a styled unicode character (pre-baked in the atlas pages). */
+            uint32_t getGlyphIndex(char32_t character, bool bold, bool italic); /* Get the index of a styled character glyph, see getGlyphAt() (0 is the fallback glyph if missing). */
+            const impl::Glyph& getGlyphAt(uint32_t index); /* Get a glyph by index (styled glyphs of each atlas glyph, after the fallback glyph). */
+            uint32_t getGlyphIndexCount(); /* Get the number of glyph indices. */
+            bool hasGlyph(char32_t character); /* Determine if a unicode character is in the atlas (always true for dynamic fonts). */
+            size_t getGlyphCount(); /* Get the number of glyphs in the atlas. */
+            size_t getGlyphMemoryUsage(); /* Get the number of bytes used by the glyph table. */
             int getGlyphSize(); /* Get the size of the glyphs in the atlas texture. */
 
+            bool isDynamic(); /* Determine if glyphs are rasterized on demand from a TrueType font. */
+            size_t getMemoryBudget(); /* Get the maximum number of bytes of the pages of a dynamic font. */
+            void setMemoryBudget(size_t budget); /* Change the bytes of pages kept by a dynamic font, least recently used glyphs are evicted above (glyphs used by the last two frames are kept, going over the budget if needed). */
+            void update(); /* Copy the glyphs rasterized since the last update to their pages, upload them (one texture update per changed page) and start a new frame (called once per frame by Window and Rasterizer). */
+            uint64_t getRevision(); /* Get a number changed each time glyphs are added to or evicted from a dynamic font. */
+            uint64_t getEvictionCount(); /* Get the number of glyphs evicted from a dynamic font (the slot of an evicted glyph is reused by another one). */
+
+            char32_t getFallbackCharacter(); /* Get the character drawn in place of characters missing from the atlas. */
+            void setFallbackCharacter(char32_t character); /* Change the character drawn in place of characters missing from the atlas. */
+
         private:
             sf::Image m_image;
-            sf::Texture m_texture;
-            impl::Glyph* m_glyphs;
+            std::deque<sf::Image> m_pages; /* Extra atlas pages (references stay valid when pages are added). */
+            std::vector<std::unique_ptr<sf::Texture>> m_textures;
+            impl::GlyphTable m_glyphs;
+            std::vector<impl::Glyph> m_variants; /* Bold, italic and bold italic glyphs (in this order) of each glyph of the table. */
+            impl::Glyph m_fallback;
+            char32_t m_fallback_character;
             int m_glyph_size;
 
-            void init(); /* Initialize the font: calculate all glyphs data. */
+            bool m_dynamic;
+            sf::Font m_trueType;
+            std::string m_trueTypePath;
+            std::unique_ptr<impl::MappedFile> m_trueTypeFile; /* File of a TrueType font loaded from a path, kept mapped while the font is used. */
+            const void* m_trueTypeData;
+            size_t m_trueTypeSize;
+            unsigned int m_characterSize;
+            sf::Vector2i m_slotSize;
+            size_t m_memoryBudget;
+            std::unordered_map<uint64_t, impl::DynamicGlyph> m_dynamicGlyphs;
+            std::list<uint64_t> m_lru; /* Keys of the dynamic glyphs, most recently used first. */
+            std::deque<impl::Glyph> m_slots; /* Glyph of each slot (references stay valid when pages are added). */
+            std::vector<uint32_t> m_freeSlots;
+            std::vector<impl::PendingGlyph> m_pending;
+            std::vector<sf::IntRect> m_dirtyRects; /* Changed area of each page since the last update. */
+            uint64_t m_frame;
+            std::atomic<uint64_t> m_revision; /* Read without the mutex to check if geometry must be built again. */
+            std::atomic<uint64_t> m_evictions;
+            std::mutex m_mutex; /* Dynamic fonts can be used by the main and render threads. */
+
+            void init(const std::string& cache_path); /* Initialize the font: calculate all glyphs data (or load them from the cache). */
+            void loadGlyphs(const std::vector<impl::Glyph>& glyphs); /* Fill the glyph table with the glyphs of the atlas (character i is glyph i) and bake their variants. */
+            void calculateGlyphs(std::vector<impl::Glyph>& glyphs, uint32_t first_row, uint32_t last_row); /* Calculate the boundaries of the glyphs in a range of atlas rows. */
             impl::Glyph calculateGlyph(int x, int y); /* Calculate the boundaries of a glyph (used during initialization). */
+            bool loadMetrics(const std::string& cache_path, uint64_t hash, std::vector<impl::Glyph>& glyphs); /* Read glyphs data from the cache if it matches the atlas hash and glyph size. */
+            void saveMetrics(const std::string& cache_path, uint64_t hash, const std::vector<impl::Glyph>& glyphs); /* Write glyphs data to the cache. */
+            void bakeVariants(); /* Pack the bold and italic variants of all glyphs into extra atlas pages. */
+            void drawVariants(std::vector<std::vector<uint8_t>>& pages, size_t first, size_t last); /* Draw the variants of a range of glyphs in their pages. */
+            int getBoldDilation() const; /* Get the width (in atlas pixels) added to bold glyphs. */
+            void initDynamic(); /* Initialize a dynamic font: character size and slot size fitting the glyph size. */
+            bool reloadTrueType(); /* Load the TrueType font again (drops its own glyph cache). */
+            const impl::Glyph& getDynamicGlyph(char32_t character, bool bold, bool italic, uint32_t* slot); /* Get a glyph of a dynamic font, rasterized in a free (or evicted) slot on first use (locked by the caller). */
+            uint32_t allocateSlot(); /* Get a free slot, add a page or evict the least recently used glyph. */
     };
 
-    /* Represent a graphical window where you can print characters. */
-    class Window
+    /* Markup text parsed once into runs of characters with the style changes to apply before them. */
+    class StyledText
     {
         public:
-            Window(); /* Create a default window. */
-            Window(const std::string& title, uint32_t width, uint32_t height); /* Create a window with custom title and size. */
-            ~Window();
+            /* Characters [begin, begin + length) printed after applying a style change. */
+            struct Run
+            {
+                impl::StyleChange change;
+                uint32_t begin;
+                uint32_t length;
+            };
 
-            sf::RenderWindow& getNativeWindow(); /* Get the SFML window. */
+            StyledText(); /* Create an empty text. */
+            explicit StyledText(std::u32string_view markup); /* Create a text from UTF-32 markup. */
+            explicit StyledText(std::string_view markup); /* Create a text from UTF-8 markup. */
 
-            Font* getFont(); /* Get the window font. */
-            void setFont(Font* font); /* Change the window font. */
+            void parse(std::u32string_view markup); /* Replace the text with UTF-32 markup (storage is reused). */
+            void parse(std::string_view markup); /* Replace the text with UTF-8 markup (storage is reused). */
 
-            int getFontSize(); /* Get the window font size. */
-            void setFontSize(int fontSize); /* Change the window font size. */
+            const std::u32string& getCharacters() const; /* Get all the characters without the tags. */
+            const std::vector<Run>& getRuns() const; /* Get the runs of characters. */
 
-            sf::Vector2f getCellSize(); /* Get the size of a character cell. */
+        private:
+            std::u32string m_characters;
+            std::vector<Run> m_runs;
 
-            sf::Vector2f getCursor(); /* Get the window cursor position. */
-            void setCursor(sf::Vector2f cursor); /* Change the window cursor position. */
+            template<typename CharT>
+            void parseMarkup(const CharT* str, size_t length); /* Parse markup into runs. */
+    };
 
-            std::map<uint32_t, std::map<uint32_t, impl::BufferCharacter>>& getScreenBuffer(); /* Get the screen buffer (table of characters to draw). */
-            void setScreenBuffer(std::map<uint32_t, std::map<uint32_t, impl::BufferCharacter>>& buffer); /* Change the screen buffer.*/
+    /* Grid of characters where you can print text with markup (no rendering, see Window and Rasterizer). */
+    class Console
+    {
+        public:
+            Console(); /* Create an empty console. */
+            Console(uint32_t columns, uint32_t rows); /* Create a console with a custom size in characters. */
+            virtual ~Console();
 
-            std::u32string getLine(uint32_t y); /* Get a string from a line in the screen buffer (Stop at EOL character). */
-            std::u32string getText(uint32_t y); /* Get a string from a line in the screen buffer. */
-            impl::BufferCharacter getCharacter(uint32_t x, uint32_t y); /* Get a character in the screen buffer. */
+            uint32_t getColumns(); /* Get the number of characters per row. */
+            uint32_t getRows(); /* Get the number of rows. */
+            void resize(uint32_t columns, uint32_t rows); /* Change the console size in characters (keep the characters that still fit). */
 
-            void print(std::u32string str); /* Print a UTF-32 string. */
-            void print(std::u32string str, uint32_t y); /* Print a UTF-32 string at a specific line. */
-            void print(std::u32string str, uint32_t x, uint32_t y); /* Print a UTF-32 string at a specific position. */
+            sf::Vector2f getCursor(); /* Get the console cursor position. */
+            void setCursor(sf::Vector2f cursor); /* Change the console cursor position. */
+
+            impl::ScreenBufferView getScreenBuffer(); /* Get a view on the screen buffer (grid of characters to draw). */
+            void setScreenBuffer(const impl::ScreenBufferView& view); /* Copy a view into the screen buffer (clipped to the grid). */
+
+            std::u32string getLine(uint64_t y); /* Get a string from a line by absolute row number, see getFirstRow() (Stop at EOL character). */
+            std::u32string getText(uint64_t y); /* Get a string from a line by absolute row number, see getFirstRow() (continues on next lines if the row is full). */
+            impl::ResolvedCharacter getCharacter(uint32_t x, uint32_t y); /* Get a character in the screen buffer with its brush. */
+            void setCharacter(uint32_t x, uint32_t y, char32_t code, const Brush& brush); /* Change a character in the screen buffer (ignored outside of the grid). */
+
+            void fillRect(const sf::IntRect& rect, char32_t code); /* Fill a rectangle with a character and the active brush (clipped to the grid). */
+            void fillRect(const sf::IntRect& rect, char32_t code, const Brush& brush); /* Fill a rectangle with a character (clipped to the grid). */
+            void clearRect(const sf::IntRect& rect); /* Reset a rectangle to empty characters (code 0). */
+            void copyRect(const sf::IntRect& source, sf::Vector2i destination); /* Copy a rectangle of the screen buffer to another position (both may overlap). */
+            void blit(Console& sprite, sf::Vector2i position); /* Copy the characters of another console at a position, empty characters (code 0) are transparent. */
+            void blit(Console& sprite, const sf::IntRect& rect, sf::Vector2i position); /* Copy a rectangle of another console (sprite sheet) at a position, empty characters are transparent. */
+
+            void print(std::u32string_view str); /* Print a UTF-32 string. */
+            void print(std::u32string_view str, uint32_t y); /* Print a UTF-32 string at a specific line. */
+            void print(std::u32string_view str, uint32_t x, uint32_t y); /* Print a UTF-32 string at a specific position. */
             
-            void print(std::string str); /* Print a string. */
-            void print(std::string str, uint32_t y); /* Print a string at a specific line. */
-            void print(std::string str, uint32_t x, uint32_t y); /* Print a string at a specific position. */
+            void print(std::string_view str); /* Print a UTF-8 string. */
+            void print(std::string_view str, uint32_t y); /* Print a UTF-8 string at a specific line. */
+            void print(std::string_view str, uint32_t x, uint32_t y); /* Print a UTF-8 string at a specific position. */
+
+            void print(const char* str); /* Print a UTF-8 string. */
+            void print(const char* str, uint32_t y); /* Print a UTF-8 string at a specific line. */
+            void print(const char* str, uint32_t x, uint32_t y); /* Print a UTF-8 string at a specific position. */
 
+            void print(const StyledText& text); /* Print a parsed markup text. */
+            void print(const StyledText& text, uint32_t y); /* Print a parsed markup text at a specific line. */
+            void print(const StyledText& text, uint32_t x, uint32_t y); /* Print a parsed markup text at a specific position. */
+
+            Brush getDefaultBrush(); /* Get the brush used after a reset. */
             void setForegroundColor(sf::Color color); /* Set default text color */
             void setBackgroundColor(sf::Color color); /* Set default background color */
 
@@ -169,28 +878,419 @@ namespace seag
 
             void resetStyle(); /* Reset active colors and text style to default */
 
+            bool isRetainedMode(); /* Determine if the screen buffer is kept between frames. */
+            void setRetainedMode(bool retained); /* Keep the screen buffer on clear() so only changed rows are drawn again. */
+            void invalidate(); /* Force the whole screen buffer to be drawn again on next display. */
+
+            void clear(); /* Clear the screen buffer (unless retained), reset the cursor and the brush. */
+
+            uint32_t getScrollback(); /* Get the maximum number of rows kept above the screen. */
+            void setScrollback(uint32_t rows); /* Keep rows scrolled off the top in a ring buffer, printing a new line on the last row scrolls (0 disables scrolling). */
+            uint32_t getScrollbackSize(); /* Get the number of rows currently kept above the screen. */
+            uint64_t getFirstRow(); /* Get the absolute row number of the first row of the screen (number of rows scrolled off the top). */
+
+            uint32_t getViewOffset(); /* Get the number of rows the view is moved up into the scrollback. */
+            void setViewOffset(uint32_t offset); /* Move the view up into the scrollback (0 shows the screen, printing resets it). */
+            void scrollView(int32_t rows); /* Move the view up (positive) or down (negative) into the scrollback. */
+
+            void flush(); /* Apply the commands sent by printers (called by Window::display). */
+
+            bool isPrintTiming(); /* Determine if the time spent in print is measured (FrameStats::printTime). */
+            void setPrintTiming(bool enabled); /* Measure the time spent in print, off by default since the clock is read twice per call (calls are always counted). */
+
+        protected:
+            sf::Vector2f m_cursor;
+            impl::ScreenBuffer m_screenBuffer;
+            impl::BrushTable m_brushes;
+
+            Brush m_default_brush;
+            Brush m_active_brush;
+
+            bool m_retained;
+
+            sf::Time m_printTime;
+            uint32_t m_printCalls;
+            bool m_printTiming;
+
+            impl::PrintQueue m_printQueue;
+            friend class Printer;
+
+            std::vector<impl::BufferCharacter> m_blitCells; /* Characters of the last blit with brush ids of this console. */
+
+            template<typename CharT>
+            void printMarkup(const CharT* str, size_t length); /* Parse markup and write its characters at the cursor. */
+            void applyStyle(const impl::StyleChange& change); /* Change the active brush with a markup style change. */
+            template<typename Function>
+            void timePrint(Function&& function); /* Count a print call and time it if print timing is enabled. */
+            void putCharacter(char32_t character); /* Write a character at the cursor with the active brush. */
+            void putCharacters(const char32_t* begin, const char32_t* end); /* Write characters at the cursor with the active brush. */
+            void putCharacters(const char* begin, const char* end); /* Write UTF-8 characters at the cursor with the active brush. */
+            void applyCommand(const impl::PrintCommand& command); /* Apply a printer command with the cursor and brush of its printer. */
+            uint16_t getBrushId(const Brush& brush); /* Get the id of a brush in the brush table (unused brushes are dropped when it is full). */
+            virtual void compactBrushes(); /* Drop the brushes no longer used by any cell and remap the cells. */
+    };
+
+    /* Print to a console from any thread, commands are queued without locks and applied by Console::flush. */
+    class Printer
+    {
+        public:
+            Printer(Console& console); /* Create a printer with its own cursor and brush (starts with the default brush of the console when its commands are applied, can be created on any thread). */
+
+            void print(std::u32string_view str); /* Print a UTF-32 string. */
+            void print(std::u32string_view str, uint32_t y); /* Print a UTF-32 string at a specific line. */
+            void print(std::u32string_view str, uint32_t x, uint32_t y); /* Print a UTF-32 string at a specific position. */
+
+            void print(std::string_view str); /* Print a UTF-8 string. */
+            void print(std::string_view str, uint32_t y); /* Print a UTF-8 string at a specific line. */
+            void print(std::string_view str, uint32_t x, uint32_t y); /* Print a UTF-8 string at a specific position. */
+
+            void setCursor(sf::Vector2f cursor); /* Change the printer cursor position. */
+
+            void pushForegroundColor(sf::Color color); /* Set text color for next prints */
+            void pushBackgroundColor(sf::Color color); /* Set background color for next prints */
+            void pushBold(bool bold); /* Enable or disable bold style for next prints */
+            void pushItalic(bool italic); /* Enable or disable italic style for next prints */
+
+            void resetStyle(); /* Reset active colors and text style to the console default */
+
+        private:
+            Console* m_console;
+            std::shared_ptr<impl::PrinterState> m_state;
+
+            impl::PrintCommand* createCommand(impl::PrintCommand::Type type); /* Allocate a command for this printer. */
+    };
+
+    /* Console drawn over the screen buffer of a window, at an offset in cells and sorted by z-order (empty cells and transparent backgrounds show what is below). */
+    class Layer : public Console
+    {
+        public:
+            Layer(uint32_t columns, uint32_t rows); /* Create a visible layer at (0, 0) with a transparent default background. */
+
+            sf::Vector2i getPosition(); /* Get the position of the layer in cells. */
+            void setPosition(sf::Vector2i position); /* Move the layer (its geometry is kept). */
+
+            int getZOrder(); /* Get the drawing order of the layer (higher is drawn over lower). */
+            void setZOrder(int zOrder); /* Change the drawing order of the layer. */
+
+            bool isVisible(); /* Determine if the layer is drawn. */
+            void setVisible(bool visible); /* Show or hide the layer (its geometry is kept). */
+
+            bool isDirty(); /* Determine if characters changed since the layer geometry was built. */
+
+        private:
+            sf::Vector2i m_position;
+            int m_zOrder;
+            bool m_visible;
+            bool m_changed; /* Position, z-order or visibility changed since the last frame. */
+            std::shared_ptr<const impl::LayerGeometry> m_geometry;
+
+            friend class Window;
+    };
+
+    /* Grid of characters without bounds, stored in chunks allocated on first write, the window draws only the chunks in the view and builds the geometry of changed chunks only. */
+    class World
+    {
+        public:
+            World(); /* Create an empty world (no chunk allocated). */
+
+            impl::ResolvedCharacter getCharacter(int x, int y); /* Get a character with its brush (empty outside of allocated chunks). */
+            void setCharacter(int x, int y, char32_t code, const Brush& brush); /* Change a character (its chunk is allocated if needed). */
+            void fillRect(const sf::IntRect& rect, char32_t code, const Brush& brush); /* Change all characters of a rectangle. */
+            void clearRect(const sf::IntRect& rect); /* Reset a rectangle to empty characters (code 0, no chunk is allocated). */
+            void clear(); /* Drop all chunks. */
+
+            size_t getChunkCount(); /* Get the number of allocated chunks. */
+            size_t getMemoryUsage(); /* Get the number of bytes used by the characters of the chunks. */
+
+            bool hasView(); /* Determine if the world is drawn through its own view. */
+            sf::View getView(); /* Get the view of the world in pixels (cell (x, y) is at x * cell width, y * cell height). */
+            void setView(const sf::View& view); /* Draw the world through its own view (the window view is used until it is set). */
+            void resetView(); /* Draw the world through the window view. */
+
+        private:
+            std::unordered_map<uint64_t, std::unique_ptr<impl::WorldChunk>> m_chunks;
+            impl::BrushTable m_brushes;
+            sf::View m_view;
+            bool m_hasView;
+            bool m_changed; /* Characters or the view changed since the last frame. */
+
+            impl::WorldChunk* getChunk(int32_t x, int32_t y, bool create); /* Find a chunk by position in chunks (nullptr if missing and not created). */
+            void writeRect(const sf::IntRect& rect, const impl::BufferCharacter& character, bool create); /* Change the characters of a rectangle chunk by chunk. */
+            uint16_t getBrushId(const Brush& brush); /* Get the id of a brush in the brush table (unused brushes are dropped when it is full). */
+
+            friend class Window;
+    };
+
+    /* Represent a graphical window where you can print characters. */
+    class Window : public Console
+    {
+        public:
+            Window(); /* Create a default window. */
+            Window(const std::string& title, uint32_t width, uint32_t height); /* Create a window with custom title and size. */
+            ~Window();
+
+            sf::RenderWindow& getNativeWindow(); /* Get the SFML window. */
+
+            std::shared_ptr<Font> getFont(); /* Get the window font. */
+            void setFont(std::shared_ptr<Font> font); /* Change the window font (shared with other windows, see Font::load). */
+
+            int getFontSize(); /* Get the window font size. */
+            void setFontSize(int fontSize); /* Change the window font size. */
+
+            sf::Vector2f getCellSize(); /* Get the size of a character cell. */
+
             bool isOpen(); /* Determine if the window is open. */
 
-            bool waitEvent(sf::Event& event); /* Get SFML event (freeze execution). */
-            bool pollEvent(sf::Event& event); /* Get SFML event. */
+            bool waitEvent(sf::Event& event); /* Get SFML event (freeze execution, resize the screen buffer on sf::Event::Resized). */
+            bool pollEvent(sf::Event& event); /* Get SFML event (resize the screen buffer on sf::Event::Resized). */
 
-            void clear(); /* Clear the window and screen buffer. */
-            void display(); /* Display the screen buffer to the window. */
+            void clear(); /* Clear the window and screen buffer (the screen buffer is kept in retained mode). */
+            void display(); /* Display the screen buffer to the window (same as present() in threaded mode). */
             void close(); /* Close the window. */
 
+            bool isGridMode(); /* Determine if the screen buffer is drawn by the grid renderer. */
+            bool setGridMode(bool enabled); /* Draw the screen buffer as a cell data texture in one full-screen pass (return false if shaders are not available). */
+
+            bool isThreaded(); /* Determine if frames are drawn by a render thread. */
+            void setThreaded(bool threaded); /* Draw frames on a render thread, print writes to a back buffer swapped by present(). */
+            void present(); /* Hand the back buffer to the render thread (waits until the previous frame geometry is built). */
+
+            bool needsRedraw(); /* Determine if display() would change the window: changed rows, layers or worlds, moved window view, resize, overlay (printer commands are applied). */
+            void requestRedraw(); /* Make needsRedraw() return true until the next frame. */
+
+            sf::Time getTimestep(); /* Get the time step of the updates of run(). */
+            void setTimestep(sf::Time timestep); /* Call the update of run() with a fixed time step, independently of the frame rate (zero calls it once per loop with the elapsed time). */
+            uint32_t addTimer(sf::Time interval, std::function<void()> callback, bool repeat = true); /* Call a function after an interval from run() (the loop wakes up for it), return the timer id. */
+            void removeTimer(uint32_t id); /* Stop a timer. */
+
+            void run(const std::function<void(const sf::Event&)>& event, const std::function<void(sf::Time)>& update, const std::function<void()>& render); /* Loop until the window is closed: events, timers and updates, then render() and display() if needsRedraw(), waiting in waitEvent when idle (empty functions are skipped, Closed closes the window without an event function). */
+
+            void addLayer(Layer* layer); /* Draw a layer over the screen buffer (not owned, remove it before destroying it). */
+            void removeLayer(Layer* layer); /* Stop drawing a layer. */
+
+            void addWorld(World* world); /* Draw the chunks of a world in its view, over the screen buffer and under the layers (not owned, remove it before destroying it). */
+            void removeWorld(World* world); /* Stop drawing a world. */
+
+            FrameStats getStats(); /* Get the counters and timings of the last displayed frame. */
+            bool isStatsOverlay(); /* Determine if the stats of the last frame are drawn over the screen. */
+            void setStatsOverlay(bool enabled); /* Draw the stats of the last frame in the top right corner of the window (enables print timing). */
+
+            bool startTrace(const std::string& path); /* Write the phases of each frame to a Chrome trace event file (chrome://tracing, enables print timing). */
+            void stopTrace(); /* Finish and close the trace file. */
+
         private:
             sf::RenderWindow m_window;
 
-            Font *m_font;
+            std::shared_ptr<Font> m_font;
             int m_fontSize;
-            sf::Vector2f m_cursor;
-            std::map<uint32_t, std::map<uint32_t, impl::BufferCharacter>> m_screenBuffer;
             
-            sf::Shader m_shader;
+            std::shared_ptr<sf::Shader> m_shader; /* Shared by all windows. */
 
-            Brush m_default_brush;
-            Brush m_active_brush;
+            sf::RenderTexture m_canvas;
+            sf::VertexArray m_clearVertices;
+            sf::VertexArray m_backgroundVertices;
+            std::vector<sf::VertexArray> m_glyphVertices;
+
+            impl::GridRenderer m_grid;
+            bool m_gridMode;
+
+            impl::ScreenBuffer m_frontBuffer;
+            std::vector<Layer*> m_layers;
+            std::vector<World*> m_worlds;
+
+            impl::FrameState m_pendingFrame;
+            impl::FrameState m_renderFrame;
+
+            std::thread m_renderThread;
+            std::mutex m_renderMutex;
+            std::condition_variable m_renderCondition;
+            bool m_threaded;
+            bool m_framePending;
+            bool m_renderStop;
+
+            FrameStats m_stats;
+            sf::Clock m_clock;
+            sf::Time m_frameStart;
+            uint32_t m_uniformUpdates;
+            bool m_statsOverlay;
+            sf::VertexArray m_overlayBackgroundVertices;
+            std::vector<sf::VertexArray> m_overlayGlyphVertices;
+
+            std::ofstream m_trace;
+            bool m_traceEmpty;
+
+            bool m_redrawPending;
+            sf::View m_presentedView;
+            sf::Time m_timestep;
+            std::vector<impl::Timer> m_timers;
+            uint32_t m_nextTimer;
+
+            void resizeScreenBuffer(); /* Fit the screen buffer to the window and cell sizes. */
+            void handleEvent(const sf::Event& event); /* Process events needed by the window itself (resize). */
+            void startFrame(); /* Capture the state read while drawing (font, size, background, print stats) in the pending frame. */
+            void prepareLayers(); /* Build the geometry of changed layers and list the visible ones in the pending frame. */
+            void prepareWorlds(); /* Build the geometry of changed chunks in the view of each world and list them in the pending frame. */
+            bool prepareCanvas(); /* Recreate the canvas if the window size changed (return true if it was recreated). */
+            void buildFrame(const impl::ScreenBuffer& buffer, bool redraw); /* Build the geometry of changed rows (all rows if redraw). */
+            void submitFrame(); /* Draw the geometry to the canvas and the window, then display it. */
+            void renderLoop(); /* Body of the render thread. */
+            void runTimers(sf::Time now); /* Call the timers due at a time of the window clock. */
+            bool waitIdle(sf::Time deadline, sf::Event& event); /* Wait for an event until a time of the window clock (without a deadline if zero), return true if an event was received. */
+            void stopRenderThread(); /* Draw the pending frame and join the render thread. */
+            void compactBrushes() override; /* Drop unused brushes from both buffers (waits until the render thread no longer reads the front buffer). */
+            void appendCell(const impl::FrameState& frame, char32_t code, const Brush& brush, sf::Vector2f pos, sf::VertexArray& backgrounds, std::vector<sf::VertexArray>& glyphs); /* Add the quads of a character (background skipped if it is the frame background). */
+            uint32_t drawGlyphs(sf::RenderTarget& target, const std::vector<sf::VertexArray>& glyphs, Font* font, const sf::Transform& transform); /* Draw the glyph quads of each atlas page, return the number of draw calls. */
+            uint32_t drawChunk(impl::ChunkGeometry& chunk, const sf::Transform& transform); /* Upload the geometry of a chunk to vertex buffers if needed and draw it, return the number of draw calls. */
+            void drawStatsOverlay(); /* Draw the stats of the last frame to the window. */
+            void writeTraceEvent(const std::string& name, sf::Time start, sf::Time duration); /* Write a complete event to the trace file. */
+            void writeTraceCounter(const std::string& name, sf::Time time, double value); /* Write a counter event to the trace file. */
+    };
+
+    /* Console drawn to a VT/ANSI terminal with truecolor escape sequences (no display needed, works over SSH), only changed cells are written. */
+    class Terminal : public Console
+    {
+        public:
+            Terminal(int output = 1); /* Create a console sized from the terminal of a file descriptor (stdout by default, 80x25 if it is not a terminal). */
+            Terminal(uint32_t columns, uint32_t rows, int output = 1); /* Create a console with a custom size writing to a file descriptor (a pseudo-terminal for example). */
+            ~Terminal(); /* Restore the terminal (colors, cursor and main screen) if something was displayed. */
+
+            int getOutput(); /* Get the file descriptor written by display(). */
+            bool updateSize(); /* Resize the console to the terminal size if it changed (return true if it did, call it on SIGWINCH). */
+
+            void display(); /* Write the cells changed since the last frame (the alternate screen is used from the first frame). */
+            void redraw(); /* Clear the terminal and write all cells on next display (if something else wrote to the terminal). */
+
+            uint64_t getWrittenBytes(); /* Get the number of bytes written to the terminal. */
+
+        private:
+            int m_output;
+            bool m_started;
+
+            std::vector<impl::BufferCharacter> m_previous;
+            uint32_t m_previousColumns;
+            uint32_t m_previousRows;
+            bool m_redraw;
+
+            std::string m_data;
+            uint64_t m_writtenBytes;
+
+            Brush m_sgr;
+            bool m_sgrValid;
+            uint32_t m_cursorX;
+            uint32_t m_cursorY;
+            bool m_cursorValid;
+
+            void moveCursor(uint32_t x, uint32_t y, const impl::BufferCharacter* row); /* Append the shortest sequence moving the cursor (unchanged cells of row may be written again when shorter). */
+            void setBrush(const Brush& brush); /* Append a SGR sequence with the parameters that differ from the terminal state. */
+            void putCell(const impl::BufferCharacter& cell); /* Append a character (controls are written as spaces) and advance the cursor. */
+            bool writeData(); /* Write the pending sequences to the output (return false on error). */
+            void compactBrushes() override; /* Drop unused brushes and remap the cells of the last frame. */
+    };
+
+    /* Draw a screen buffer into RGBA pixels on the CPU, without OpenGL (same placement and styles as Window::display). */
+    class Rasterizer
+    {
+        public:
+            Rasterizer(); /* Create a rasterizer with the default font. */
+            Rasterizer(std::shared_ptr<Font> font, int fontSize); /* Create a rasterizer with a custom font (shared, see Font::load). */
+
+            std::shared_ptr<Font> getFont(); /* Get the rasterizer font. */
+            void setFont(std::shared_ptr<Font> font); /* Change the rasterizer font (shared with windows and other rasterizers, see Font::load). */
+
+            int getFontSize(); /* Get the rasterizer font size. */
+            void setFontSize(int fontSize); /* Change the rasterizer font size. */
+
+            sf::Vector2f getCellSize(); /* Get the size of a character cell. */
+            sf::Vector2u getImageSize(uint32_t columns, uint32_t rows); /* Get the size in pixels of a grid of characters. */
+
+            unsigned int getThreadCount(); /* Get the number of threads drawing row bands. */
+            void setThreadCount(unsigned int count); /* Change the number of threads drawing row bands (0 to use all cores). */
+
+            void render(Console& console, sf::Image& image); /* Draw a console into an image (resized to fit the console). */
+            void render(const impl::ScreenBufferView& view, sf::Color background, uint8_t* pixels, uint32_t width, uint32_t height); /* Draw characters into RGBA pixels (clipped to width x height). */
+
+        private:
+            std::shared_ptr<Font> m_font;
+            int m_fontSize;
+            unsigned int m_threadCount;
+            std::vector<uint8_t> m_pixels;
+            std::vector<std::vector<uint8_t>> m_brightness; /* Brightness of each atlas page. */
+            Font* m_brightnessFont;
+            uint64_t m_brightnessRevision; /* Font::getRevision() of the brightness (pages of dynamic fonts change). */
+            std::unordered_map<uint64_t, impl::GlyphBitmap> m_bitmaps;
+            Font* m_bitmapsFont;
+            int m_bitmapsFontSize;
+
+            void renderRows(const impl::ScreenBufferView& view, sf::Color background, uint8_t* pixels, uint32_t width, uint32_t height, uint32_t first_row, uint32_t last_row); /* Draw a band of character rows. */
+            void prepareBitmaps(const impl::ScreenBufferView& view); /* Build the missing glyph bitmaps of a view. */
+            void buildBitmap(char32_t code, bool bold, bool italic, impl::GlyphBitmap& bitmap); /* Rasterize the coverage of a glyph in a cell. */
+            const uint8_t* getBrightness(uint32_t page); /* Get the brightness of each pixel of an atlas page (computed once per font). */
+    };
+
+    /* Record the screen of a console to a file: a keyframe, then the cells and brushes changed in each frame (written by a background thread). */
+    class Recorder
+    {
+        public:
+            Recorder();
+            ~Recorder();
+
+            bool start(const std::string& path, bool compress = true); /* Start writing frames to a file (frames are LZ compressed if it makes them smaller). */
+            void stop(); /* Write the queued frames and close the file. */
+            bool isRecording(); /* Determine if frames are written to a file. */
+
+            void capture(Console& console); /* Queue the changes of the screen since the previous capture (a keyframe first, when the size changes and periodically). */
+
+            uint64_t getFrameCount(); /* Get the number of frames captured since start. */
+            uint64_t getWrittenBytes(); /* Get the number of bytes written to the file. */
+
+        private:
+            std::ofstream m_file;
+            bool m_compress;
+
+            std::vector<impl::RecordedCell> m_previous; /* Screen of the previous capture. */
+            uint32_t m_columns;
+            uint32_t m_rows;
+            std::unordered_map<Brush, uint32_t, impl::BrushHash> m_brushIds; /* Recorded brushes since the last keyframe. */
+            std::vector<uint64_t> m_consoleBrushes; /* Capture number << 32 | recorded id of each console brush id. */
+            uint64_t m_frameCount;
+            uint32_t m_framesSinceKeyframe;
+            sf::Clock m_clock;
+
+            std::thread m_writer;
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+            std::deque<std::vector<uint8_t>> m_queue;
+            bool m_stop;
+            std::atomic<uint64_t> m_writtenBytes;
+
+            uint32_t getRecordedBrush(const impl::BrushTable& brushes, uint16_t id, std::vector<uint8_t>& definitions); /* Get the recorded id of a console brush (its definition is added to the frame if it is new). */
+            void writeLoop(); /* Compress and write queued frames until stopped. */
+    };
+
+    /* Play a recording by copying its frames into a console (keep the console between frames, do not clear it). */
+    class Player
+    {
+        public:
+            Player();
+
+            bool open(const std::string& path); /* Read a recording file (false if it is missing or invalid). */
+            void rewind(); /* Go back to the first frame. */
+
+            bool nextFrame(Console& console); /* Apply the next frame to a console (false at the end of the recording or if a frame is invalid). */
+            uint64_t getFrame(); /* Get the number of frames played. */
+            sf::Time getFrameDelay(); /* Get the time between the last played frame and the previous one when they were recorded. */
+
+        private:
+            std::vector<uint8_t> m_data;
+            size_t m_offset;
+            std::vector<uint8_t> m_frame; /* Decompressed frame. */
+            std::vector<Brush> m_brushes; /* Recorded brushes since the last keyframe. */
+            uint32_t m_columns;
+            uint32_t m_rows;
+            uint64_t m_frameIndex;
+            sf::Time m_frameDelay;
 
+            bool readCell(impl::ByteReader& reader, Console& console, uint32_t index); /* Read a character and write it at a cell index of the recorded screen. */
     };
 };
 
@@ -1,226 +1,475 @@
-#include <stdint.h>
+//Generated by atlas_generator from cp437_atlas.png, do not edit.
+#include "seag.hpp"
 
-#define SEAG_CP437_ATLAS_SIZE 3448
+#define SEAG_CP437_ATLAS_WIDTH 160
+#define SEAG_CP437_ATLAS_HEIGHT 160
+#define SEAG_CP437_ATLAS_SIZE 3200
+#define SEAG_CP437_GLYPH_SIZE 10
+#define SEAG_CP437_GLYPH_COUNT 256
 
 namespace seag
 {
-    const uint8_t SEAG_CP437_ATLAS[SEAG_CP437_ATLAS_SIZE] = {
-        0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 
-        0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0x08, 0x02, 0x00, 0x00, 0x00, 0x04, 0xAD, 0xF0, 
-        0x7A, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0B, 0x13, 0x00, 0x00, 0x0B, 
-        0x13, 0x01, 0x00, 0x9A, 0x9C, 0x18, 0x00, 0x00, 0x0D, 0x2A, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 
-        0xED, 0x5D, 0xDB, 0x76, 0xC3, 0x28, 0x0C, 0x24, 0x39, 0xF9, 0xFF, 0x5F, 0xCE, 0x3E, 0x64, 0xD7, 
-        0x4B, 0x41, 0x1A, 0x8D, 0x2E, 0x38, 0xAE, 0xCB, 0x3C, 0xF4, 0xA4, 0x06, 0x84, 0x10, 0x20, 0x74, 
-        0xC1, 0xC9, 0xA3, 0x11, 0x78, 0xBF, 0xDF, 0xC3, 0x93, 0xC7, 0xE3, 0x41, 0x96, 0x5E, 0x0D, 0x33, 
-        0xB7, 0x3C, 0xE7, 0x64, 0xDB, 0xA1, 0xDA, 0x40, 0xB3, 0x2F, 0x3D, 0x41, 0x50, 0x2F, 0x52, 0x22, 
-        0xC3, 0x8C, 0xBE, 0xDF, 0xEF, 0xCF, 0x13, 0x71, 0xCC, 0x47, 0xE9, 0xD0, 0x7C, 0x26, 0xA5, 0x75, 
-        0x51, 0x55, 0xFA, 0x15, 0x60, 0xC9, 0xF4, 0x15, 0x7A, 0x41, 0x0D, 0x75, 0x06, 0x6A, 0x1A, 0x41, 
-        0x71, 0xF5, 0xF4, 0x0F, 0xED, 0x09, 0x9E, 0xA9, 0x3C, 0x1E, 0x0F, 0xBC, 0x96, 0x67, 0x5E, 0xFB, 
-        0xFA, 0xC3, 0xA8, 0xFA, 0x3A, 0x60, 0xB4, 0x81, 0xD2, 0x0C, 0xF0, 0x3E, 0xC3, 0x0A, 0xEC, 0x78, 
-        0xC2, 0x0B, 0x6A, 0x86, 0xB6, 0x4A, 0xC4, 0xF9, 0x16, 0x37, 0xE1, 0xE7, 0xC9, 0xD3, 0x3B, 0x60, 
-        0xBC, 0x8E, 0xBC, 0x52, 0x1E, 0xA8, 0xB9, 0xC4, 0x61, 0xB6, 0x7D, 0x77, 0x10, 0x79, 0x3E, 0xE0, 
-        0xA2, 0x3C, 0x2F, 0x77, 0xB1, 0x72, 0x72, 0xC1, 0x69, 0x6C, 0x83, 0x11, 0x89, 0x73, 0xC4, 0x4E, 
-        0x30, 0x9E, 0x42, 0x3C, 0xFD, 0x60, 0x0C, 0xF8, 0x21, 0x10, 0x74, 0xA6, 0x6D, 0xB3, 0x26, 0xE9, 
-        0x78, 0x08, 0x26, 0x49, 0x94, 0x32, 0xDE, 0x55, 0xED, 0xA7, 0x72, 0x6E, 0x70, 0x11, 0x68, 0x8B, 
-        0x4F, 0x7C, 0x0E, 0x9E, 0x50, 0x2A, 0xBA, 0xE5, 0x54, 0x56, 0x0C, 0xE6, 0xE9, 0x7E, 0x59, 0xE0, 
-        0x23, 0xF6, 0xD0, 0xDB, 0xA6, 0xE6, 0xE0, 0x85, 0xA3, 0x2D, 0x35, 0x87, 0x8A, 0x8E, 0xED, 0x60, 
-        0x6D, 0x67, 0x30, 0xA5, 0xFD, 0x93, 0xC0, 0xA4, 0x92, 0x8A, 0x54, 0x13, 0x50, 0xD3, 0x95, 0x64, 
-        0x86, 0xAB, 0x9E, 0xE6, 0x40, 0x1F, 0xCF, 0x2E, 0x53, 0x53, 0x14, 0x2C, 0xB5, 0x83, 0x3F, 0x2B, 
-        0x11, 0x9B, 0x73, 0xA0, 0x57, 0xB0, 0xFB, 0x41, 0xA9, 0x68, 0xA1, 0xF4, 0x63, 0x30, 0xDD, 0xB3, 
-        0xB0, 0xCF, 0x83, 0x79, 0xD6, 0x8C, 0x44, 0x06, 0xD8, 0x9B, 0x20, 0x59, 0x9D, 0x75, 0x00, 0xD0, 
-        0xA9, 0x54, 0x1F, 0x79, 0x3F, 0x78, 0x9D, 0x23, 0x94, 0x14, 0x96, 0xC9, 0xB9, 0xB7, 0x2D, 0xE3, 
-        0xE6, 0x9A, 0x2A, 0xDA, 0x2B, 0x40, 0xC4, 0x95, 0xB7, 0xC1, 0xC9, 0xC0, 0xF2, 0x0A, 0x04, 0x0D, 
-        0x4E, 0x08, 0x74, 0x6C, 0x6C, 0x9C, 0x87, 0xF8, 0x91, 0x60, 0xC6, 0x50, 0xE6, 0xE7, 0x9A, 0x3F, 
-        0x3E, 0xF2, 0xA4, 0x1F, 0xF6, 0x31, 0x3F, 0xFB, 0x36, 0x31, 0xB2, 0x66, 0x05, 0x7C, 0x66, 0x59, 
-        0x3D, 0xFB, 0x4A, 0xA6, 0xBD, 0xE0, 0x72, 0xB1, 0x19, 0x5E, 0x9B, 0x65, 0x54, 0xB7, 0x9F, 0x9E, 
-        0x5F, 0xCC, 0xCF, 0x2E, 0xE4, 0x99, 0x94, 0x46, 0x95, 0xAF, 0x98, 0xC7, 0xE8, 0x26, 0x05, 0x98, 
-        0xCE, 0x44, 0xA3, 0x30, 0x7A, 0x87, 0x72, 0xB0, 0xE4, 0x4D, 0x60, 0xAE, 0x4A, 0x78, 0x16, 0xD7, 
-        0x9C, 0xA9, 0x15, 0x48, 0x77, 0x08, 0x2C, 0x4A, 0x46, 0xB1, 0x1D, 0x4F, 0x64, 0x37, 0x69, 0xD6, 
-        0xAB, 0xE4, 0x38, 0x57, 0x04, 0x84, 0x71, 0xDC, 0x20, 0xCC, 0x55, 0xEF, 0x6C, 0x84, 0x23, 0x0C, 
-        0xC7, 0xC3, 0x41, 0x56, 0x4C, 0x3C, 0xC0, 0x24, 0x5E, 0x12, 0xD5, 0x91, 0x03, 0x1D, 0xFD, 0x5E, 
-        0x89, 0x79, 0xF4, 0x0C, 0xA9, 0x80, 0xD6, 0xE5, 0x01, 0x42, 0x0A, 0xCD, 0xF2, 0x98, 0xD7, 0xE9, 
-        0x24, 0xCC, 0xB0, 0xC8, 0xB9, 0xC8, 0x06, 0xDE, 0xC4, 0x28, 0xD0, 0x01, 0x0E, 0xC2, 0x66, 0x1D, 
-        0x66, 0x4D, 0x37, 0xA3, 0xB4, 0xFD, 0x84, 0xE7, 0xF8, 0xB3, 0xB7, 0x34, 0xEF, 0xD0, 0x1C, 0x64, 
-        0xC0, 0x89, 0x12, 0xC5, 0x0D, 0xE4, 0x33, 0x9B, 0x11, 0x8C, 0x26, 0x13, 0x19, 0x1B, 0xDA, 0x56, 
-        0x69, 0xC4, 0xFF, 0x77, 0x30, 0xB3, 0x53, 0xB5, 0xF0, 0x37, 0xF8, 0x37, 0x8C, 0xFE, 0xDC, 0x8D, 
-        0xED, 0xF5, 0x70, 0x8E, 0x8B, 0x1C, 0x11, 0x4E, 0x27, 0x00, 0x01, 0x6A, 0x89, 0x2C, 0xF0, 0x2F, 
-        0x4E, 0x6C, 0xF4, 0xF5, 0x47, 0x22, 0xAE, 0x91, 0x03, 0xAC, 0x3B, 0x83, 0xF9, 0x31, 0x9F, 0x19, 
-        0x5F, 0x3B, 0x19, 0xD8, 0x9F, 0xEC, 0xAB, 0x5D, 0x84, 0xE1, 0x8D, 0xBF, 0x84, 0x4B, 0x39, 0x8E, 
-        0x37, 0x03, 0x9B, 0x2E, 0x6C, 0x9C, 0x8B, 0x3C, 0xD7, 0x39, 0x9E, 0xAC, 0x98, 0x45, 0x70, 0xBD, 
-        0xC1, 0x64, 0x9B, 0x1F, 0xD4, 0x6F, 0xC4, 0xC1, 0x7C, 0xCD, 0x95, 0x9D, 0x12, 0x56, 0xC0, 0xE2, 
-        0xD0, 0xFE, 0x6D, 0x39, 0x5F, 0x0B, 0x7B, 0xC9, 0x4D, 0xF7, 0x1A, 0x00, 0xCF, 0x57, 0x40, 0xCF, 
-        0x92, 0x63, 0x07, 0x6B, 0x60, 0x6C, 0x3F, 0x6D, 0x7D, 0x1C, 0x22, 0xD6, 0x6E, 0xA8, 0xCC, 0x35, 
-        0x03, 0x43, 0x05, 0x97, 0x14, 0xF0, 0xA5, 0x99, 0xA6, 0x1B, 0x6B, 0xC7, 0xD4, 0x6A, 0xC4, 0xBF, 
-        0x35, 0xF1, 0xA3, 0xE7, 0xE6, 0x6A, 0xD6, 0x8F, 0xD0, 0xDB, 0x9F, 0x99, 0x04, 0x6D, 0x7E, 0x83, 
-        0x76, 0x70, 0x91, 0x5D, 0x36, 0x24, 0xEF, 0xB0, 0x32, 0xE9, 0x7D, 0x32, 0xF5, 0xB2, 0x1A, 0x73, 
-        0xBF, 0xEC, 0x9D, 0x2C, 0xD2, 0x85, 0x0F, 0xA0, 0xCF, 0x1D, 0x81, 0x54, 0x09, 0x78, 0x7E, 0xE6, 
-        0x76, 0x31, 0xB3, 0xFA, 0x38, 0xEC, 0x83, 0x91, 0xCC, 0x9E, 0xC9, 0x7E, 0xF9, 0x52, 0x71, 0x98, 
-        0xDE, 0x9B, 0x19, 0xB3, 0x05, 0xC1, 0x9D, 0x7C, 0xDC, 0x27, 0xE6, 0x07, 0x33, 0xFD, 0xAE, 0xF3, 
-        0xB0, 0xBD, 0x3D, 0x16, 0x58, 0xD1, 0x00, 0x73, 0x2C, 0x69, 0x3E, 0xB0, 0x41, 0xBC, 0x09, 0x0B, 
-        0x62, 0x4E, 0x42, 0xC4, 0xD8, 0x03, 0xF1, 0x57, 0xCD, 0xFE, 0xAA, 0x0A, 0xD4, 0x57, 0xA1, 0x46, 
-        0xB9, 0xC6, 0x34, 0x21, 0xE3, 0x26, 0x5D, 0xD3, 0x16, 0x5D, 0x84, 0x45, 0xEE, 0xE2, 0xB7, 0x87, 
-        0xB5, 0xB1, 0xB1, 0xB1, 0x02, 0xB2, 0xBD, 0xE3, 0x75, 0x1C, 0x71, 0x5B, 0xDE, 0x11, 0x6A, 0x96, 
-        0x4F, 0x02, 0x4C, 0x56, 0x57, 0x32, 0xB1, 0x84, 0xE7, 0x0C, 0xD6, 0x59, 0x85, 0x03, 0xCF, 0xCF, 
-        0xA1, 0xA5, 0x76, 0x0D, 0x05, 0x47, 0xFB, 0x70, 0x5B, 0x50, 0x3A, 0x73, 0x36, 0x43, 0x0B, 0x83, 
-        0x30, 0x94, 0x35, 0x23, 0x28, 0xCF, 0x73, 0x06, 0x61, 0x9B, 0x88, 0xB1, 0x0A, 0x87, 0x3A, 0x2F, 
-        0xB1, 0x1E, 0x4F, 0xD7, 0x64, 0xD4, 0x1C, 0xC6, 0x10, 0x09, 0xD1, 0x2A, 0x60, 0x52, 0x20, 0x4B, 
-        0xBD, 0xC8, 0x7D, 0x0F, 0x3B, 0x42, 0x49, 0x7E, 0x0E, 0xBF, 0x9F, 0x4C, 0x5A, 0xFF, 0x98, 0xE0, 
-        0x4F, 0xB3, 0xF0, 0x82, 0x65, 0x74, 0xB8, 0x2B, 0xE2, 0x33, 0xA8, 0xEB, 0x37, 0xBC, 0x31, 0xEA, 
-        0x92, 0x26, 0xBE, 0x2B, 0xB2, 0x2E, 0x78, 0xC2, 0xEB, 0x58, 0x30, 0x28, 0x6D, 0x8E, 0xC5, 0x2E, 
-        0x5E, 0x26, 0xB9, 0x12, 0xD6, 0x67, 0x9F, 0x55, 0x1B, 0x98, 0x37, 0x65, 0x8D, 0x29, 0x33, 0xDC, 
-        0xE2, 0x0D, 0xB1, 0x48, 0x6F, 0x15, 0xB6, 0xD2, 0xC6, 0xF5, 0x01, 0x1B, 0xAA, 0xF4, 0xD2, 0x65, 
-        0x8A, 0x9A, 0x64, 0x52, 0xE1, 0x27, 0xE7, 0x20, 0x16, 0xA6, 0x66, 0x4A, 0x99, 0xCD, 0xA7, 0xC9, 
-        0x87, 0xE9, 0x5A, 0xE8, 0x51, 0xA4, 0xEE, 0xB2, 0x48, 0x93, 0xF6, 0x2A, 0xE6, 0x3B, 0x69, 0xEB, 
-        0xAE, 0xB3, 0xFC, 0x33, 0xC1, 0xC8, 0x15, 0xA1, 0xCA, 0x3C, 0xE5, 0x0D, 0x16, 0xCC, 0xF9, 0x9D, 
-        0x0C, 0x0B, 0x6E, 0x6C, 0x6C, 0xFC, 0x0D, 0x64, 0x23, 0x59, 0xAE, 0x03, 0xB8, 0x79, 0x0E, 0x6F, 
-        0x9C, 0x6A, 0x34, 0x13, 0x91, 0x8D, 0xB0, 0x2A, 0x40, 0xCA, 0x8F, 0x94, 0x86, 0xC6, 0x15, 0xC8, 
-        0x69, 0x6A, 0x34, 0x41, 0x32, 0xD4, 0xFC, 0x17, 0xC8, 0x99, 0x8A, 0x64, 0xF5, 0x4F, 0x34, 0x42, 
-        0x62, 0xDB, 0x7E, 0xC0, 0x60, 0x90, 0x4C, 0xA9, 0xE6, 0xC6, 0x68, 0x77, 0x7D, 0x92, 0xD1, 0x28, 
-        0x90, 0xC4, 0x04, 0x15, 0x48, 0xDF, 0xC9, 0xB4, 0x34, 0xCD, 0x98, 0x0F, 0x18, 0xEC, 0x30, 0xDE, 
-        0x27, 0x43, 0xA2, 0x50, 0x58, 0x66, 0x34, 0x0A, 0x10, 0xE7, 0x5D, 0xCF, 0x8B, 0x18, 0x93, 0x99, 
-        0x80, 0x73, 0xAC, 0x74, 0x46, 0x8D, 0x1F, 0xDC, 0x24, 0xED, 0x74, 0x0E, 0xE5, 0x58, 0x20, 0x73, 
-        0x68, 0x5B, 0x8E, 0xB0, 0x34, 0x3E, 0x8E, 0x32, 0x8E, 0x27, 0xBA, 0xD8, 0x66, 0x5F, 0x3E, 0x33, 
-        0xE9, 0xC6, 0x22, 0x4A, 0xE4, 0x98, 0xC3, 0xA5, 0x0D, 0xCA, 0x3A, 0xA0, 0x90, 0xC8, 0x4D, 0x99, 
-        0x91, 0x06, 0x5E, 0xA9, 0xDE, 0x45, 0x29, 0x5F, 0xD9, 0x71, 0x65, 0x66, 0x48, 0xA1, 0x34, 0xCB, 
-        0x8D, 0x33, 0x65, 0xC7, 0x8F, 0x0D, 0x58, 0x4F, 0x67, 0xC2, 0x5C, 0x40, 0x01, 0x15, 0xE2, 0x1D, 
-        0xCE, 0xEB, 0x68, 0x06, 0x82, 0xEF, 0x00, 0xB3, 0xF1, 0x35, 0x18, 0x1D, 0x83, 0xD5, 0x20, 0x1A, 
-        0x7E, 0x64, 0xA9, 0xD6, 0x2F, 0x8E, 0xC8, 0x7B, 0x25, 0x88, 0xE9, 0x3F, 0x9C, 0x6F, 0xB4, 0x62, 
-        0x59, 0xC5, 0x30, 0xEF, 0xE3, 0x79, 0xB0, 0x5F, 0xB7, 0x3F, 0x36, 0x36, 0x36, 0x36, 0x36, 0x4C, 
-        0xA0, 0xD7, 0x6F, 0x0E, 0x84, 0xA3, 0x51, 0x73, 0x9D, 0x40, 0x9E, 0x4A, 0xB3, 0x98, 0x40, 0x29, 
-        0x19, 0xF7, 0x09, 0x50, 0xF6, 0x8A, 0x6B, 0x68, 0xC8, 0xDB, 0xFC, 0x4D, 0x77, 0x0B, 0x5D, 0xE7, 
-        0xEB, 0xB3, 0x49, 0x81, 0x88, 0x39, 0x1A, 0x25, 0x46, 0x49, 0xCC, 0xB6, 0x43, 0x73, 0x2C, 0x9D, 
-        0xDF, 0x65, 0x17, 0x98, 0x3E, 0x05, 0x88, 0xAF, 0x85, 0xC9, 0xE2, 0x38, 0x97, 0x88, 0x82, 0xB7, 
-        0x0B, 0x33, 0x42, 0x21, 0x2F, 0x16, 0xAD, 0xE0, 0xA4, 0x59, 0x6F, 0x08, 0x32, 0xCD, 0x5D, 0x6D, 
-        0x63, 0x71, 0xC0, 0x03, 0x5A, 0x58, 0x1B, 0xE3, 0x39, 0x90, 0x08, 0xFB, 0x8E, 0x5A, 0xDB, 0x41, 
-        0x94, 0x27, 0x83, 0x09, 0x7C, 0x82, 0x00, 0x08, 0x1E, 0x51, 0x40, 0x50, 0xE1, 0x39, 0xEE, 0xBB, 
-        0x73, 0x11, 0xF9, 0x31, 0xC1, 0x5A, 0xE0, 0xDE, 0x25, 0x2F, 0xB1, 0x28, 0xB9, 0x78, 0x57, 0x00, 
-        0x7B, 0xA5, 0xF8, 0xE0, 0xC8, 0x84, 0x50, 0xC2, 0xF1, 0xFC, 0xC1, 0x1D, 0x27, 0x7B, 0xB7, 0x55, 
-        0xF4, 0xBC, 0x05, 0x71, 0x82, 0x65, 0x3E, 0x83, 0x63, 0xBA, 0xC5, 0xCB, 0xD8, 0x9C, 0xD5, 0xE9, 
-        0x4F, 0x2C, 0x2D, 0x5D, 0x18, 0x8E, 0x56, 0x6A, 0xFF, 0xBA, 0x38, 0xAF, 0x12, 0x05, 0xC0, 0xB3, 
-        0x11, 0x11, 0x96, 0x61, 0xBD, 0x88, 0x09, 0x41, 0x73, 0x30, 0xDA, 0xAA, 0x07, 0xBD, 0x9B, 0x6D, 
-        0xF9, 0xA4, 0x9E, 0x17, 0x4C, 0xD4, 0xC9, 0x8C, 0xBC, 0x9A, 0x0A, 0x4F, 0x4C, 0xCB, 0xD6, 0x4E, 
-        0xFC, 0x6F, 0x32, 0x5C, 0xEF, 0x87, 0xAA, 0xC4, 0x0C, 0xD8, 0x99, 0xDF, 0x1E, 0xE2, 0xC6, 0xC6, 
-        0x46, 0x06, 0x35, 0x57, 0xE9, 0x5B, 0x5A, 0x1B, 0x84, 0xE9, 0x64, 0x32, 0x60, 0xB8, 0x09, 0x63, 
-        0x2A, 0x8B, 0x21, 0x33, 0xD0, 0xEA, 0xFC, 0x84, 0x8F, 0xEF, 0x1B, 0xDF, 0x67, 0x54, 0x71, 0x99, 
-        0xC9, 0x34, 0x7B, 0x8D, 0x52, 0xB2, 0x2F, 0xC6, 0x15, 0x99, 0xBD, 0x97, 0x3C, 0xCD, 0x5A, 0xB0, 
-        0xBF, 0x9B, 0x64, 0x8E, 0x01, 0x2C, 0x5E, 0xE6, 0x36, 0x61, 0xA6, 0x6B, 0x4C, 0xF6, 0x01, 0xBF, 
-        0x1F, 0x28, 0x76, 0xA5, 0xD2, 0x55, 0x87, 0x9C, 0xD1, 0x4C, 0x46, 0x00, 0xB0, 0xF4, 0x1C, 0x1E, 
-        0x81, 0xBB, 0x1C, 0x78, 0xA3, 0xC4, 0x62, 0xD1, 0x43, 0xA9, 0x26, 0x20, 0xD0, 0xB6, 0x49, 0xBA, 
-        0xA7, 0x6F, 0x88, 0x67, 0x57, 0xA4, 0x1C, 0xD8, 0xBB, 0x80, 0xF9, 0xE6, 0x81, 0x19, 0xAB, 0xF2, 
-        0xCA, 0x99, 0x7A, 0xBB, 0xB0, 0xCA, 0x33, 0x4B, 0xDE, 0xF8, 0x99, 0xA9, 0x25, 0x2F, 0xE5, 0xAC, 
-        0xD3, 0x96, 0xD7, 0x89, 0xD9, 0xF9, 0x7E, 0x20, 0x3A, 0xC9, 0x77, 0x66, 0x51, 0x7B, 0x9B, 0xAC, 
-        0x8B, 0x7E, 0x33, 0xA3, 0xC8, 0x5C, 0xBA, 0xAB, 0x45, 0xF6, 0x78, 0x48, 0xE6, 0x83, 0x9B, 0x75, 
-        0xB4, 0x90, 0xB9, 0x64, 0x33, 0x7E, 0x2E, 0x46, 0xE2, 0x56, 0x64, 0x7C, 0xC3, 0x94, 0x93, 0x39, 
-        0x6C, 0x8D, 0xAB, 0xDB, 0x46, 0x3A, 0xF6, 0x0D, 0xB4, 0x8D, 0x8D, 0x8D, 0xDF, 0x8F, 0x4B, 0xE8, 
-        0xAE, 0xAF, 0x5B, 0x22, 0x8B, 0x06, 0xF5, 0xF9, 0xA0, 0x99, 0x1D, 0xD8, 0x77, 0xD7, 0x08, 0x7A, 
-        0x05, 0x75, 0xEA, 0x95, 0x1D, 0x2C, 0x88, 0x3B, 0x01, 0xFB, 0xF7, 0x1A, 0x40, 0xB0, 0x61, 0x4E, 
-        0x5F, 0xE2, 0xF7, 0x01, 0x0E, 0xBC, 0x7A, 0x6E, 0xCC, 0x0B, 0xFB, 0xB3, 0xEB, 0x39, 0x17, 0x35, 
-        0x4F, 0x08, 0x86, 0x79, 0xB9, 0x01, 0x5B, 0xA4, 0x62, 0x69, 0xE6, 0x5F, 0xB2, 0x5F, 0x6D, 0x44, 
-        0xEB, 0x60, 0x5E, 0x7E, 0x3A, 0x2E, 0x38, 0xF4, 0xFC, 0x3C, 0xFB, 0x96, 0xE2, 0x0A, 0xC2, 0x51, 
-        0xA1, 0x5E, 0x4C, 0x66, 0x34, 0x0A, 0x5C, 0xBA, 0x33, 0x6F, 0x0B, 0xC5, 0x00, 0xAE, 0xE3, 0x80, 
-        0xFB, 0x1E, 0x8C, 0xAC, 0xC1, 0x5D, 0x03, 0x93, 0x26, 0x1E, 0xA9, 0x16, 0x5C, 0xD3, 0x3E, 0xCC, 
-        0x9D, 0xF6, 0x6D, 0xCB, 0x54, 0xF4, 0x11, 0x63, 0x13, 0xA7, 0xF0, 0xFD, 0x1F, 0xAA, 0xBA, 0x2B, 
-        0xE1, 0x76, 0xD1, 0x95, 0x4A, 0x33, 0x28, 0x64, 0x5E, 0x05, 0x69, 0xCE, 0xF5, 0x01, 0xAE, 0xE4, 
-        0x9D, 0x71, 0x06, 0x33, 0xA1, 0x6C, 0x73, 0xD8, 0x40, 0x8E, 0x99, 0x3B, 0x59, 0x4D, 0x57, 0xB9, 
-        0xE6, 0x35, 0xA3, 0x33, 0xAF, 0x56, 0x85, 0x21, 0x07, 0xA4, 0x02, 0x87, 0x68, 0x53, 0x16, 0x9D, 
-        0x99, 0x03, 0x69, 0xD0, 0x7A, 0x34, 0x93, 0x42, 0xE6, 0x1C, 0xE0, 0x23, 0xB6, 0xC1, 0x1D, 0x63, 
-        0x06, 0x8C, 0x32, 0x83, 0xF2, 0x5A, 0xD1, 0x00, 0xE0, 0x24, 0xB2, 0x07, 0xC9, 0x70, 0x76, 0x33, 
-        0xDC, 0x29, 0x0A, 0xA6, 0xBE, 0x8A, 0x72, 0xEF, 0x61, 0xFF, 0x1D, 0x54, 0xCE, 0x93, 0xA9, 0x79, 
-        0x1A, 0x71, 0x16, 0x92, 0x1A, 0x78, 0x26, 0x9E, 0x51, 0x6B, 0xB5, 0x5C, 0x81, 0xD3, 0xC1, 0xD5, 
-        0x35, 0x10, 0x2F, 0x9F, 0x6C, 0xA0, 0x8C, 0xAC, 0xDE, 0xFC, 0xD1, 0x4C, 0x21, 0xF3, 0x2C, 0x8C, 
-        0x99, 0x24, 0xB8, 0x55, 0xD8, 0xD8, 0x59, 0xCA, 0x55, 0xA6, 0x6B, 0x26, 0xD5, 0x3F, 0x7C, 0xC6, 
-        0x64, 0x29, 0x73, 0xC9, 0x5C, 0x3B, 0x5F, 0x44, 0xD5, 0xAD, 0xBF, 0xDF, 0x02, 0x73, 0x8B, 0x0F, 
-        0xD2, 0x10, 0x8C, 0xAC, 0xC0, 0x14, 0xF2, 0x19, 0xDF, 0x5D, 0x9A, 0xC9, 0x70, 0xC7, 0xFB, 0x35, 
-        0x5D, 0x6F, 0x7C, 0x01, 0xCA, 0x54, 0xE0, 0xE7, 0x97, 0x66, 0x78, 0x2E, 0x19, 0x6F, 0x78, 0x38, 
-        0xE0, 0x10, 0x0C, 0x70, 0xF5, 0x12, 0x09, 0xB5, 0x22, 0x57, 0xCC, 0x2C, 0x5A, 0x5A, 0x7A, 0x20, 
-        0x76, 0xD7, 0xAC, 0xA4, 0xEB, 0xAF, 0x23, 0xFB, 0x35, 0x4A, 0x07, 0x4C, 0x93, 0x52, 0x14, 0xCA, 
-        0xBA, 0x52, 0xAD, 0x26, 0xC3, 0x73, 0xBE, 0x74, 0x1D, 0xBC, 0xCB, 0x2E, 0x12, 0x64, 0xD1, 0x62, 
-        0x43, 0xDA, 0xE0, 0xC9, 0xB6, 0xEB, 0x4A, 0x9B, 0x75, 0x62, 0x35, 0x78, 0x1C, 0x26, 0x4B, 0xB1, 
-        0xAC, 0xFA, 0x52, 0xA6, 0xA1, 0x37, 0xB7, 0xA6, 0x5E, 0x18, 0xBB, 0x07, 0xAE, 0x66, 0xF3, 0x9F, 
-        0x8F, 0xDB, 0x8E, 0x7C, 0xC7, 0xDD, 0xFE, 0x1D, 0xFB, 0xB7, 0x19, 0xB8, 0x22, 0x62, 0xCA, 0x50, 
-        0xA3, 0x50, 0xC8, 0xD2, 0x07, 0xBE, 0x5B, 0x22, 0x25, 0x9C, 0xF1, 0xA7, 0xCE, 0x8A, 0xA0, 0xA0, 
-        0x36, 0xEC, 0x4C, 0xD8, 0x2F, 0x09, 0x6F, 0x38, 0xC2, 0xE4, 0xEA, 0xDD, 0xDD, 0xA7, 0x78, 0xC3, 
-        0x2B, 0x6C, 0xC3, 0x51, 0xFB, 0xD4, 0x3A, 0xF0, 0x0E, 0xA6, 0x67, 0x5A, 0x5C, 0xEF, 0xE5, 0x41, 
-        0x41, 0x93, 0x72, 0x32, 0xA0, 0x78, 0x40, 0x2C, 0x9A, 0x3F, 0xCF, 0x02, 0x01, 0x96, 0xFF, 0xA2, 
-        0x5C, 0xB2, 0xB0, 0x44, 0x34, 0x56, 0x80, 0x69, 0x37, 0x97, 0x5E, 0x33, 0x8A, 0x59, 0x29, 0xA6, 
-        0x8A, 0x9B, 0x62, 0xA6, 0x88, 0xF0, 0x0E, 0x3E, 0xAA, 0x99, 0xDB, 0xB7, 0xAF, 0x60, 0xBF, 0x7C, 
-        0x36, 0xCF, 0xE5, 0x67, 0xD9, 0x6A, 0x4A, 0x38, 0xE3, 0xAE, 0x14, 0x66, 0xA2, 0xF2, 0xE7, 0x68, 
-        0x1E, 0x9A, 0xFB, 0xA4, 0x39, 0x2C, 0x0F, 0xEB, 0x17, 0x15, 0x8F, 0xE6, 0x58, 0x50, 0xFD, 0x88, 
-        0x5E, 0x62, 0x25, 0xE0, 0xD8, 0x81, 0x0D, 0x6D, 0x1E, 0xA2, 0xDA, 0xCA, 0x88, 0x95, 0x5E, 0x1F, 
-        0x83, 0x40, 0x1E, 0xD6, 0xEB, 0x90, 0x73, 0xF4, 0x51, 0x9B, 0xC8, 0x99, 0x8E, 0x36, 0x05, 0xF6, 
-        0x0E, 0xEE, 0x37, 0x6E, 0xBB, 0x85, 0x06, 0x6E, 0xD3, 0x5E, 0x59, 0x47, 0x19, 0x8B, 0xEB, 0x3D, 
-        0x7D, 0xDB, 0x78, 0xB3, 0x34, 0x0A, 0x73, 0x09, 0xE9, 0x47, 0xFD, 0xBE, 0xC6, 0x40, 0x68, 0x28, 
-        0x7A, 0xFC, 0xFC, 0xA2, 0xF1, 0x99, 0x1B, 0x4D, 0x9D, 0x2E, 0x52, 0xD1, 0xC9, 0x52, 0x2C, 0x9D, 
-        0x24, 0x65, 0x93, 0xA6, 0xD8, 0x16, 0xCF, 0x82, 0x78, 0x56, 0x8A, 0xD3, 0xF4, 0x83, 0x42, 0xFB, 
-        0xAB, 0x58, 0x1A, 0x09, 0xC9, 0x68, 0x3B, 0x6D, 0x71, 0xF0, 0xC6, 0xDA, 0xC6, 0x1F, 0xC6, 0xA2, 
-        0x93, 0xE9, 0xEF, 0x00, 0xA4, 0x69, 0xCD, 0xD2, 0x15, 0x10, 0xAC, 0x68, 0xEF, 0x71, 0x95, 0x2C, 
-        0x3D, 0x27, 0x5F, 0x74, 0x8E, 0x36, 0x9B, 0xE7, 0xAF, 0x49, 0xD6, 0x0C, 0x23, 0x90, 0x2A, 0x86, 
-        0x85, 0xAF, 0x13, 0xC6, 0xDC, 0xAF, 0x98, 0xDD, 0xA4, 0x2F, 0x2B, 0x46, 0x85, 0x98, 0x98, 0x51, 
-        0xF9, 0x06, 0xC2, 0xC7, 0x64, 0xFE, 0x10, 0xD5, 0x82, 0x68, 0x20, 0xB8, 0xE6, 0x78, 0x47, 0xE1, 
-        0x6A, 0x58, 0x17, 0xCA, 0xA8, 0x4A, 0xE8, 0xBA, 0xB2, 0xC8, 0x8B, 0xC6, 0x1B, 0x31, 0xF1, 0xCB, 
-        0xE3, 0x4D, 0xA6, 0x44, 0xC8, 0xE6, 0xCD, 0xA3, 0xC0, 0x5B, 0x85, 0x92, 0x0C, 0x27, 0x48, 0x1E, 
-        0xD6, 0xDB, 0xB6, 0xDE, 0xAC, 0x8C, 0x56, 0xE7, 0x35, 0x14, 0x6B, 0x60, 0x82, 0xFE, 0x2D, 0x1A, 
-        0x6F, 0x32, 0xDB, 0xBE, 0xF5, 0x9F, 0x37, 0x33, 0xC9, 0xBA, 0xE6, 0x26, 0x0F, 0x3C, 0x7F, 0x73, 
-        0xA9, 0xD8, 0x1C, 0x0C, 0xD9, 0x8B, 0xD7, 0x3C, 0xDA, 0xAB, 0x59, 0xD1, 0x5A, 0xD4, 0x89, 0xC9, 
-        0x82, 0xE0, 0xD2, 0xA5, 0xEE, 0xEF, 0xBC, 0x6A, 0xE7, 0x98, 0x20, 0x2F, 0xEA, 0x3E, 0x05, 0x00, 
-        0xD2, 0x01, 0xEC, 0x95, 0x9D, 0x5A, 0x65, 0x58, 0x98, 0x30, 0xA8, 0x9A, 0x95, 0x45, 0xC9, 0x06, 
-        0x1C, 0x8E, 0x78, 0x77, 0xBF, 0x1B, 0xCB, 0x1C, 0x3A, 0xBC, 0x4D, 0x0A, 0x68, 0xFE, 0x02, 0x63, 
-        0x6A, 0x11, 0x56, 0x1B, 0x95, 0xA6, 0x5B, 0xA8, 0xF5, 0x5E, 0xAB, 0x5D, 0xFE, 0xEE, 0x04, 0xAF, 
-        0x06, 0xB3, 0x80, 0x4E, 0x8A, 0x38, 0x6A, 0xA1, 0x96, 0x3E, 0x33, 0x05, 0xFE, 0x1E, 0x07, 0xE4, 
-        0xF0, 0x79, 0xE8, 0x02, 0x9C, 0x37, 0xB1, 0x52, 0xE0, 0xFC, 0xE5, 0x05, 0x02, 0x28, 0x67, 0xFA, 
-        0xCD, 0x53, 0xF6, 0xF6, 0xF8, 0xE3, 0x4B, 0x58, 0xE6, 0xCF, 0xC7, 0xB1, 0xA1, 0xFD, 0x05, 0xCD, 
-        0x37, 0xAE, 0x80, 0x7F, 0xBF, 0x46, 0xA9, 0x8F, 0xF8, 0x0C, 0x9F, 0xCD, 0xBF, 0xFD, 0x6A, 0x08, 
-        0xD8, 0x87, 0x22, 0xD6, 0x2D, 0x11, 0x6F, 0x10, 0x23, 0xCF, 0x73, 0x7E, 0xD1, 0x67, 0xDA, 0xEE, 
-        0x1D, 0x7C, 0x73, 0x7C, 0x6D, 0x07, 0x33, 0x71, 0x15, 0xAD, 0x26, 0x6E, 0x8B, 0x77, 0x12, 0xEF, 
-        0xFB, 0x79, 0x91, 0xC9, 0x76, 0x68, 0x66, 0x50, 0x4C, 0x1A, 0x7D, 0xFD, 0xBD, 0x83, 0x6F, 0x8E, 
-        0xAF, 0xED, 0xE0, 0xCC, 0x1E, 0xC5, 0xCB, 0x08, 0x2F, 0x38, 0x7E, 0xF7, 0xC7, 0x92, 0x01, 0x5A, 
-        0x5B, 0x5E, 0x63, 0x61, 0xCA, 0x5E, 0x49, 0xEE, 0x1D, 0x7C, 0x73, 0x5C, 0xD4, 0x8A, 0xAE, 0xB2, 
-        0x6C, 0xBD, 0x94, 0x33, 0x0B, 0x94, 0xD1, 0x2B, 0x79, 0x9E, 0xBD, 0xD8, 0x3B, 0xF8, 0x2F, 0x21, 
-        0x13, 0x6F, 0xCA, 0x50, 0x5E, 0xC1, 0xD5, 0xB7, 0xA2, 0x51, 0xDF, 0x6D, 0x3B, 0x3F, 0xFF, 0xFE, 
-        0x17, 0x82, 0x6F, 0x2C, 0x05, 0xF5, 0xD3, 0x76, 0xD7, 0x47, 0xC6, 0xFA, 0xED, 0x29, 0xC4, 0x8E, 
-        0x18, 0xA6, 0x3E, 0xCE, 0x37, 0xE4, 0x47, 0xAD, 0x3D, 0xDF, 0x3B, 0xF8, 0xE6, 0x50, 0xBF, 0x46, 
-        0x49, 0x03, 0xBF, 0xE2, 0xBC, 0xBE, 0x20, 0x06, 0xDE, 0xA3, 0xE1, 0xFB, 0x53, 0xA0, 0x2D, 0x43, 
-        0xF3, 0x5B, 0xB6, 0x31, 0xDF, 0x76, 0xEF, 0xE0, 0x9B, 0x83, 0xFA, 0x71, 0x4A, 0x06, 0xDA, 0xFE, 
-        0xC8, 0xD3, 0x67, 0x28, 0x33, 0x67, 0x70, 0xE0, 0x72, 0x45, 0xAB, 0xF3, 0x89, 0xD7, 0x51, 0xC6, 
-        0xD8, 0x3B, 0xF8, 0xE6, 0xB8, 0x89, 0x15, 0x1D, 0xBB, 0xA8, 0xBB, 0xA2, 0xBE, 0x37, 0x43, 0xB5, 
-        0x8E, 0xF2, 0x07, 0x7B, 0x07, 0xDF, 0x1C, 0xC2, 0x3D, 0x61, 0xE6, 0xCC, 0xE3, 0xC1, 0x50, 0xAE, 
-        0xED, 0xB1, 0xAA, 0x5F, 0x2F, 0x57, 0x85, 0xF9, 0xA2, 0x4C, 0x72, 0x69, 0xC0, 0xDE, 0xC1, 0x37, 
-        0x87, 0x71, 0x06, 0x67, 0x56, 0xA5, 0x17, 0x9A, 0xCD, 0x59, 0x7B, 0xEF, 0x02, 0xE7, 0x9E, 0x97, 
-        0xDF, 0x60, 0x3D, 0x1D, 0x7B, 0x07, 0xDF, 0x1C, 0x2F, 0xED, 0xB6, 0x83, 0xD7, 0xFB, 0x9C, 0xA1, 
-        0xED, 0x42, 0x6F, 0x44, 0x49, 0x2B, 0x8D, 0x45, 0x8C, 0xAB, 0x8E, 0xB7, 0xDF, 0x92, 0x12, 0xBD, 
-        0x89, 0x9B, 0x74, 0x7D, 0xAC, 0x5B, 0x10, 0x78, 0xC9, 0xBE, 0xF2, 0x7B, 0x14, 0xDB, 0xAB, 0x31, 
-        0x2B, 0x94, 0xBF, 0xA1, 0xC8, 0xBC, 0xC5, 0x35, 0xD7, 0x8C, 0x09, 0x0B, 0xD7, 0xBF, 0xE6, 0x9E, 
-        0xDE, 0x67, 0xF0, 0xCD, 0x61, 0xA8, 0x68, 0xF0, 0x32, 0x64, 0x21, 0x56, 0xE7, 0x6D, 0xCE, 0x1F, 
-        0xD1, 0x75, 0xB0, 0x77, 0xF0, 0xCD, 0x71, 0xE7, 0xC5, 0xFB, 0x45, 0x5C, 0xC7, 0xB7, 0x2E, 0xB0, 
-        0x80, 0x40, 0x20, 0x42, 0xB4, 0x3B, 0xD6, 0x05, 0x31, 0x78, 0x98, 0xFD, 0xF2, 0xE3, 0x5D, 0x14, 
-        0x79, 0xC5, 0xE1, 0x55, 0x9E, 0x67, 0xE1, 0xAB, 0x2C, 0x35, 0x8B, 0x94, 0xFF, 0xA2, 0x05, 0xB1, 
-        0x54, 0xE4, 0x78, 0x78, 0xF8, 0x3E, 0xF7, 0x0B, 0x83, 0x99, 0x18, 0xF5, 0xCC, 0x21, 0xF8, 0x97, 
-        0x9F, 0x1E, 0x20, 0x67, 0x6D, 0xFE, 0x1A, 0x5C, 0x3A, 0x1A, 0xCF, 0x4F, 0xB1, 0xCC, 0x2B, 0x91, 
-        0x30, 0x86, 0x4E, 0xC5, 0x21, 0x0D, 0x18, 0x8A, 0xE6, 0xCF, 0x43, 0x43, 0xB1, 0xB4, 0xEF, 0xB4, 
-        0xDC, 0xBD, 0xD1, 0x28, 0x0F, 0x72, 0x1E, 0xC6, 0x6E, 0xCE, 0x77, 0x4C, 0xF8, 0xE3, 0x37, 0xDD, 
-        0x69, 0x82, 0x16, 0xE7, 0x43, 0xAC, 0x10, 0x73, 0x25, 0xB5, 0x5B, 0xBE, 0x3D, 0x4D, 0x9E, 0xB8, 
-        0x99, 0x4A, 0x1A, 0x28, 0x93, 0x77, 0x8C, 0x5D, 0x5D, 0xE7, 0x5F, 0x92, 0xD0, 0xE8, 0xCF, 0x6B, 
-        0x1D, 0x40, 0xF8, 0x51, 0x8E, 0x30, 0x5B, 0x31, 0xF0, 0x0B, 0xD3, 0x75, 0xDF, 0x2F, 0x16, 0x6C, 
-        0x01, 0x44, 0x7A, 0x52, 0x87, 0x62, 0x70, 0x11, 0x17, 0xF7, 0xAE, 0x69, 0xD0, 0x88, 0x5C, 0xF1, 
-        0x6B, 0x5D, 0x7E, 0x75, 0x45, 0x93, 0x6F, 0xB9, 0x8A, 0x16, 0x8F, 0xB4, 0x13, 0x70, 0x0C, 0xF9, 
-        0x64, 0x57, 0x78, 0xD0, 0x46, 0xDA, 0x2A, 0x14, 0xB9, 0x8A, 0xA9, 0x04, 0xB7, 0xC6, 0xCB, 0x94, 
-        0xF2, 0x01, 0x45, 0xB1, 0x02, 0x2E, 0x62, 0x8C, 0x38, 0x9E, 0x73, 0x33, 0x77, 0xD9, 0xBF, 0x60, 
-        0xC7, 0xF3, 0x1C, 0x16, 0x32, 0xC9, 0xD8, 0x2C, 0xE7, 0xE2, 0xEE, 0xCF, 0x84, 0x57, 0x22, 0x57, 
-        0x70, 0xCF, 0x36, 0x58, 0xC4, 0x2C, 0xA0, 0x8D, 0x8B, 0x62, 0x4F, 0x67, 0x18, 0x3F, 0xBE, 0x8C, 
-        0xB4, 0xC7, 0xF9, 0x01, 0x87, 0xDA, 0x4E, 0x67, 0x9A, 0x6F, 0xE9, 0x8B, 0x24, 0xD7, 0x8D, 0x14, 
-        0x1C, 0x0D, 0x9A, 0xC5, 0xB0, 0x82, 0x2B, 0x07, 0x15, 0x32, 0x8C, 0xE2, 0x6D, 0x6E, 0x8E, 0x39, 
-        0xD0, 0xF5, 0x4C, 0x53, 0x8B, 0x40, 0xAD, 0xB3, 0x2D, 0xB4, 0xA8, 0x5C, 0x78, 0xBC, 0x78, 0x13, 
-        0x6A, 0xA5, 0x35, 0xD9, 0x24, 0xD3, 0x82, 0x3F, 0xDF, 0x46, 0x3B, 0xBC, 0x91, 0xAF, 0xF4, 0x9E, 
-        0x41, 0x98, 0x5B, 0xD1, 0x45, 0xA6, 0x54, 0x34, 0x79, 0xA3, 0xEA, 0x73, 0x52, 0x86, 0x83, 0xEF, 
-        0xE1, 0x70, 0x04, 0x7E, 0xA8, 0x55, 0x30, 0x9D, 0xE0, 0x98, 0xA0, 0x93, 0xE1, 0xF4, 0x3E, 0xD6, 
-        0x54, 0xB2, 0x22, 0x5F, 0x40, 0x0A, 0x83, 0x8C, 0xC2, 0xE2, 0x00, 0x73, 0x9F, 0x01, 0xB9, 0x28, 
-        0xB5, 0x33, 0x78, 0x51, 0xB6, 0xA7, 0x59, 0x73, 0x83, 0xE3, 0xC1, 0xE5, 0x6A, 0xA6, 0xE6, 0xD2, 
-        0x9D, 0xB9, 0xD8, 0x63, 0x73, 0x8C, 0xC9, 0xE2, 0xA0, 0xDB, 0xD0, 0x69, 0xC0, 0x08, 0xF7, 0xDE, 
-        0xF2, 0x1C, 0x46, 0x9A, 0x93, 0x68, 0x19, 0x1C, 0x56, 0x34, 0xB3, 0x2A, 0x03, 0x12, 0x49, 0x02, 
-        0x5F, 0xC2, 0x65, 0x54, 0x71, 0x39, 0x62, 0xEB, 0xA9, 0x4A, 0x14, 0x23, 0x33, 0xB1, 0x96, 0x7C, 
-        0x54, 0x88, 0x0C, 0x46, 0x62, 0xCD, 0x6F, 0x56, 0xF8, 0x2D, 0x06, 0xD4, 0x5F, 0xC4, 0xA5, 0x14, 
-        0xDA, 0xFD, 0xF0, 0x0F, 0x0A, 0x42, 0x0A, 0x39, 0xFD, 0x10, 0xAB, 0xB2, 0x00, 0x00, 0x00, 0x00, 
-        0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
+    /* Atlas pixels row by row, 8 per byte from the most significant bit (set for white, opaque black otherwise). */
+    constexpr uint8_t SEAG_CP437_ATLAS[SEAG_CP437_ATLAS_SIZE] = {
+        0x00, 0x0F, 0xC3, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0x7C, 0x1E, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x67, 0xF8, 0xCC, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 
+        0x0F, 0xFC, 0x1C, 0x33, 0x03, 0xE3, 0xF8, 0x30, 0x00, 0x10, 0x27, 0xF9, 0xFE, 0x1E, 0x07, 0x81, 
+        0xE0, 0x00, 0xFF, 0xC7, 0x8E, 0x1C, 0x74, 0x33, 0x03, 0x23, 0x19, 0xB6, 0x00, 0x14, 0xA6, 0xD9, 
+        0xFE, 0x3F, 0x07, 0x83, 0xF0, 0x78, 0xE1, 0xCF, 0xCC, 0x0C, 0xE4, 0x33, 0x03, 0xE3, 0xF9, 0xFE, 
+        0x00, 0x10, 0x27, 0xF9, 0xFE, 0x7F, 0x8F, 0xC7, 0xF8, 0xFC, 0xC0, 0xCC, 0xCC, 0xCD, 0xF0, 0x1E, 
+        0x03, 0x03, 0x18, 0x78, 0x00, 0x17, 0xA6, 0x19, 0xFE, 0x7F, 0x9F, 0xE7, 0xF8, 0xFC, 0xC0, 0xCC, 
+        0xCC, 0xCD, 0x98, 0x0C, 0x0F, 0x03, 0x39, 0xFE, 0x00, 0x13, 0x27, 0x38, 0xFC, 0x3F, 0x1C, 0xE7, 
+        0xF8, 0x78, 0xE1, 0xCF, 0xCC, 0x0D, 0x98, 0x3F, 0x1F, 0x07, 0x79, 0xB6, 0x00, 0x18, 0x67, 0xF8, 
+        0x78, 0x1E, 0x0C, 0xC3, 0xF0, 0x00, 0xFF, 0xC7, 0x8E, 0x1D, 0x98, 0x0C, 0x1F, 0x0F, 0x30, 0x30, 
+        0x00, 0x0F, 0xC3, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x0F, 0xFC, 0xF0, 0x0C, 
+        0x0E, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x81, 0xE0, 0x00, 0xFF, 0xC0, 
+        0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0xC0, 
+        0xCC, 0x3F, 0x8F, 0xC0, 0x00, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFC, 
+        0x78, 0x01, 0xE1, 0xE0, 0xCC, 0x6D, 0x8C, 0x60, 0x00, 0x78, 0x1E, 0x03, 0x00, 0x60, 0x60, 0x00, 
+        0x00, 0x00, 0x81, 0xFC, 0x7E, 0x07, 0xE3, 0xF0, 0xCC, 0x6D, 0x87, 0x80, 0x00, 0xFC, 0x3F, 0x03, 
+        0x00, 0x30, 0xC0, 0x30, 0x04, 0x81, 0xC0, 0xF8, 0x7F, 0x9F, 0xE0, 0xC0, 0xCC, 0x6D, 0x8C, 0xC0, 
+        0x00, 0x30, 0x2D, 0x03, 0x07, 0xF9, 0xFE, 0x30, 0x0C, 0xC1, 0xC0, 0xF8, 0x7E, 0x07, 0xE0, 0xC0, 
+        0x00, 0x3D, 0x8C, 0xC0, 0x00, 0xFC, 0x0C, 0x0B, 0x47, 0xF9, 0xFE, 0x30, 0x1F, 0xE3, 0xE0, 0x70, 
+        0x78, 0x01, 0xE3, 0xF0, 0xCC, 0x0D, 0x87, 0x83, 0xF0, 0x78, 0x0C, 0x0F, 0xC0, 0x30, 0xC0, 0x3F, 
+        0x0C, 0xC3, 0xE0, 0x70, 0x60, 0x00, 0x61, 0xE0, 0xCC, 0x0D, 0x98, 0xC3, 0xF0, 0x30, 0x0C, 0x07, 
+        0x80, 0x60, 0x60, 0x00, 0x04, 0x87, 0xF0, 0x20, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x0F, 0xC3, 
+        0xF0, 0xFC, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x20, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x30, 0xD8, 0x0C, 0x00, 0x01, 0xC0, 0x18, 0x06, 0x06, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 0x83, 0x30, 0xD8, 0x1F, 0x0C, 0x63, 
+        0x60, 0x18, 0x0C, 0x03, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x81, 0x21, 
+        0xFC, 0x30, 0x0C, 0xC3, 0x60, 0x30, 0x18, 0x01, 0x81, 0xE0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x18, 
+        0x00, 0x07, 0x80, 0x00, 0xD8, 0x1E, 0x01, 0x81, 0xC8, 0x00, 0x18, 0x01, 0x87, 0xF8, 0x30, 0x00, 
+        0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0xD8, 0x03, 0x03, 0x03, 0x78, 0x00, 0x18, 0x01, 
+        0x81, 0xE0, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x3E, 0x06, 0x63, 
+        0x30, 0x00, 0x0C, 0x03, 0x03, 0x30, 0x30, 0x0C, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x03, 0x00, 0x00, 
+        0xD8, 0x0C, 0x0C, 0x61, 0xD8, 0x00, 0x06, 0x06, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x00, 0xC1, 0x80, 
+        0x00, 0x03, 0x00, 0x00, 0xD8, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+        0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x01, 0xE0, 
+        0x78, 0x07, 0x0F, 0xC1, 0xE0, 0xFC, 0x1E, 0x07, 0x80, 0x00, 0x00, 0x06, 0x00, 0x01, 0x80, 0x78, 
+        0x33, 0x0F, 0x03, 0x30, 0xCC, 0x0F, 0x0C, 0x03, 0x30, 0xCC, 0x33, 0x0C, 0xC0, 0x00, 0x00, 0x0C, 
+        0x00, 0x00, 0xC0, 0xCC, 0x37, 0x03, 0x00, 0x30, 0x0C, 0x1B, 0x0F, 0x83, 0x00, 0x18, 0x33, 0x0C, 
+        0xC0, 0xC0, 0x30, 0x18, 0x00, 0x00, 0x60, 0x0C, 0x3B, 0x03, 0x00, 0x60, 0x38, 0x33, 0x00, 0xC3, 
+        0xE0, 0x30, 0x1E, 0x07, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0xC0, 0x30, 0x18, 0x33, 0x03, 0x00, 0xC0, 
+        0x0C, 0x3F, 0x80, 0xC3, 0x30, 0x30, 0x33, 0x00, 0xC0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x30, 
+        0x33, 0x03, 0x01, 0x80, 0xCC, 0x03, 0x0C, 0xC3, 0x30, 0x30, 0x33, 0x0C, 0xC0, 0xC0, 0x30, 0x18, 
+        0x0F, 0xC0, 0x60, 0x00, 0x1E, 0x0F, 0xC3, 0xF0, 0x78, 0x03, 0x07, 0x81, 0xE0, 0x30, 0x1E, 0x07, 
+        0x80, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0x07, 0xE0, 0xF8, 0x7E, 0x1F, 0xC7, 0xF0, 0x78, 0x33, 0x07, 
+        0x80, 0xF1, 0xC6, 0x78, 0x18, 0xC6, 0x30, 0xF8, 0x33, 0x07, 0x83, 0x31, 0xCC, 0x33, 0x0C, 0x43, 
+        0x10, 0xCC, 0x33, 0x03, 0x00, 0x60, 0xC6, 0x30, 0x1D, 0xC7, 0x31, 0x8C, 0x37, 0x0C, 0xC3, 0x31, 
+        0x80, 0x31, 0x8C, 0x03, 0x01, 0x8C, 0x33, 0x03, 0x00, 0x60, 0xCC, 0x30, 0x1F, 0xC7, 0xB1, 0x8C, 
+        0x37, 0x0C, 0xC3, 0xE1, 0x80, 0x31, 0x8F, 0x83, 0xE1, 0x80, 0x3F, 0x03, 0x00, 0x60, 0xF8, 0x30, 
+        0x1A, 0xC7, 0xF1, 0x8C, 0x30, 0x0F, 0xC3, 0x31, 0x80, 0x31, 0x8C, 0x03, 0x01, 0x9C, 0x33, 0x03, 
+        0x06, 0x60, 0xCC, 0x30, 0x18, 0xC6, 0xF1, 0x8C, 0x31, 0x0C, 0xC3, 0x31, 0xCC, 0x33, 0x0C, 0x43, 
+        0x00, 0xCC, 0x33, 0x03, 0x06, 0x60, 0xC6, 0x31, 0x18, 0xC6, 0x71, 0x8C, 0x1E, 0x0C, 0xC7, 0xE0, 
+        0xF8, 0x7E, 0x1F, 0xC7, 0x80, 0x7C, 0x33, 0x07, 0x83, 0xC1, 0xC6, 0x7F, 0x18, 0xC6, 0x30, 0xF8, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x87, 0xE0, 
+        0x78, 0x3F, 0x0C, 0xC3, 0x31, 0x8C, 0x33, 0x0C, 0xC3, 0xF0, 0x78, 0x40, 0x07, 0x80, 0x80, 0x00, 
+        0x33, 0x18, 0xC3, 0x30, 0xCC, 0x2D, 0x0C, 0xC3, 0x31, 0x8C, 0x33, 0x0C, 0xC3, 0x30, 0x60, 0x60, 
+        0x01, 0x81, 0xC0, 0x00, 0x33, 0x18, 0xC3, 0x30, 0xC0, 0x0C, 0x0C, 0xC3, 0x31, 0x8C, 0x1E, 0x0C, 
+        0xC2, 0x60, 0x60, 0x30, 0x01, 0x83, 0x60, 0x00, 0x3E, 0x18, 0xC3, 0xE0, 0x70, 0x0C, 0x0C, 0xC3, 
+        0x31, 0xAC, 0x0C, 0x07, 0x80, 0xC0, 0x60, 0x18, 0x01, 0x86, 0x30, 0x00, 0x30, 0x19, 0xC3, 0x60, 
+        0x18, 0x0C, 0x0C, 0xC3, 0x31, 0xAC, 0x1E, 0x03, 0x01, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x00, 0x00, 
+        0x30, 0x0F, 0x83, 0x30, 0xCC, 0x0C, 0x0C, 0xC1, 0xE0, 0xF8, 0x33, 0x03, 0x03, 0x90, 0x60, 0x06, 
+        0x01, 0x80, 0x00, 0x00, 0x78, 0x03, 0xC7, 0x30, 0x78, 0x1E, 0x07, 0x80, 0xC0, 0xD8, 0x33, 0x07, 
+        0x83, 0xF0, 0x78, 0x03, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x03, 
+        0x00, 0x31, 0xC0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x01, 
+        0xB0, 0x00, 0x30, 0x00, 0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0F, 0x03, 0xE0, 
+        0x78, 0x1F, 0x07, 0x81, 0x80, 0xEC, 0x36, 0x0F, 0x00, 0xF0, 0xCC, 0x0C, 0x1F, 0x83, 0xE0, 0x78, 
+        0x0C, 0x01, 0x83, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0xE1, 0x98, 0x3B, 0x03, 0x00, 0x30, 0xD8, 0x0C, 
+        0x1A, 0xC3, 0x30, 0xCC, 0x00, 0x0F, 0x83, 0x30, 0xC0, 0x33, 0x0F, 0xC1, 0x81, 0x98, 0x33, 0x03, 
+        0x00, 0x30, 0xF8, 0x0C, 0x1A, 0xC3, 0x30, 0xCC, 0x00, 0x19, 0x83, 0x30, 0xCC, 0x33, 0x0C, 0x01, 
+        0x80, 0xF8, 0x33, 0x03, 0x03, 0x30, 0xCC, 0x0C, 0x1A, 0xC3, 0x30, 0xCC, 0x00, 0x0F, 0xC7, 0xE0, 
+        0x78, 0x1F, 0x07, 0x83, 0xC0, 0x18, 0x73, 0x0F, 0xC1, 0xE1, 0xCC, 0x3F, 0x18, 0xC3, 0x30, 0x78, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0C, 0x0E, 0x03, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 
+        0x03, 0x07, 0x90, 0x20, 0x6E, 0x0E, 0xC7, 0x70, 0x7C, 0x3F, 0x0C, 0xC3, 0x31, 0x8C, 0x63, 0x0C, 
+        0xC3, 0xF0, 0x30, 0x0C, 0x03, 0x04, 0xF0, 0x70, 0x33, 0x19, 0x83, 0xB0, 0xC0, 0x18, 0x0C, 0xC3, 
+        0x31, 0xAC, 0x36, 0x0C, 0xC2, 0x60, 0x60, 0x00, 0x01, 0x80, 0x60, 0xD8, 0x33, 0x19, 0x83, 0x00, 
+        0x78, 0x18, 0x0C, 0xC3, 0x31, 0xAC, 0x1C, 0x0C, 0xC0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0x01, 0x8C, 
+        0x33, 0x19, 0x83, 0x00, 0x0C, 0x1B, 0x0C, 0xC1, 0xE0, 0xF8, 0x36, 0x07, 0x81, 0x90, 0x30, 0x0C, 
+        0x03, 0x00, 0x01, 0x8C, 0x3E, 0x0F, 0x87, 0x80, 0xF8, 0x0E, 0x07, 0x60, 0xC0, 0xD8, 0x63, 0x01, 
+        0x83, 0xF0, 0x1C, 0x0C, 0x0E, 0x00, 0x01, 0xFC, 0x30, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xC0, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x60, 0x78, 0x33, 0x06, 0x00, 0xE0, 0x00, 0x1E, 0x0C, 0xC1, 0x80, 0x6C, 0x0F, 
+        0x06, 0x03, 0x30, 0x78, 0x00, 0x0C, 0xC0, 0xC0, 0xCC, 0x33, 0x03, 0x01, 0xB0, 0x00, 0x33, 0x0C, 
+        0xC0, 0xC0, 0x6C, 0x19, 0x83, 0x00, 0x00, 0xCC, 0x1E, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x78, 0x33, 0x00, 0x01, 0xE0, 
+        0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x0F, 0x01, 0xE0, 0x78, 
+        0x30, 0x0C, 0xC3, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0x18, 0x06, 
+        0x03, 0x03, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0xC0, 0x3F, 0x0F, 
+        0xC3, 0xF0, 0x18, 0x06, 0x03, 0x03, 0x30, 0xCC, 0x1E, 0x0C, 0xC3, 0x00, 0xCC, 0x33, 0x0C, 0xC3, 
+        0x30, 0xCC, 0x30, 0x0C, 0x03, 0x00, 0x18, 0x06, 0x03, 0x03, 0xF0, 0xFC, 0x06, 0x07, 0x61, 0xF0, 
+        0x76, 0x1D, 0x87, 0x61, 0xD8, 0x78, 0x1F, 0x07, 0xC1, 0xF0, 0x7E, 0x1F, 0x8F, 0xC3, 0x30, 0xCC, 
+        0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x0C, 0xC3, 0x30, 0x30, 0x00, 0x00, 0x07, 0x80, 0x00, 0x06, 0x00, 0x01, 0xF8, 
+        0x78, 0x33, 0x06, 0x01, 0xE0, 0x60, 0x33, 0x00, 0x00, 0x00, 0x30, 0x1E, 0x0C, 0xC4, 0x40, 0x1C, 
+        0x0C, 0x00, 0x03, 0xE0, 0xCC, 0x33, 0x03, 0x03, 0x30, 0x30, 0x33, 0x07, 0x83, 0x30, 0x78, 0x33, 
+        0x0C, 0xC4, 0x40, 0x36, 0x3F, 0x1F, 0xC6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 
+        0xC3, 0x30, 0xCC, 0x30, 0x0C, 0xC7, 0x80, 0x30, 0x30, 0x03, 0x67, 0xF8, 0x78, 0x1E, 0x07, 0x83, 
+        0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xC0, 0x7E, 0x07, 0x84, 0x40, 0xFC, 0x3E, 0x0F, 0xE6, 0x60, 
+        0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x30, 0x0F, 0xC4, 0xF0, 0x30, 
+        0x30, 0x1B, 0x06, 0x60, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x1F, 0x0C, 0xC3, 0x30, 0x78, 0x31, 
+        0x03, 0x04, 0x61, 0xB0, 0x3F, 0x1D, 0xE6, 0x78, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x03, 0x07, 
+        0x81, 0xE0, 0x30, 0x7E, 0x0F, 0xC4, 0x68, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0x04, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x21, 
+        0x80, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80, 0x60, 0x18, 0x1D, 0x87, 0x61, 0xE0, 0x78, 0x00, 0x00, 
+        0x00, 0x01, 0x8C, 0x63, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x37, 0x0D, 0xC3, 
+        0x30, 0xCC, 0x0C, 0x00, 0x00, 0x00, 0x98, 0x26, 0x03, 0x01, 0x99, 0x98, 0x1E, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x03, 0x30, 0xCC, 0x00, 0x0F, 0xC3, 0xF1, 0xF0, 0x7C, 0x00, 0x03, 0x30, 0xCC, 
+        0x03, 0x07, 0x81, 0xE0, 0xCC, 0x3E, 0x0E, 0x61, 0xF8, 0x78, 0x0C, 0x0C, 0x00, 0x30, 0x60, 0x1B, 
+        0x83, 0x06, 0x60, 0x66, 0x1F, 0x01, 0x83, 0x30, 0xCC, 0x33, 0x0F, 0x60, 0x00, 0x00, 0x18, 0x0C, 
+        0x00, 0x30, 0xDC, 0x37, 0x87, 0x86, 0x60, 0x66, 0x33, 0x01, 0x83, 0x30, 0xCC, 0x33, 0x0D, 0xE3, 
+        0xF8, 0xFE, 0x30, 0x0C, 0x00, 0x31, 0x86, 0x6D, 0x87, 0x83, 0x30, 0xCC, 0x1D, 0x87, 0xE1, 0xE0, 
+        0x78, 0x33, 0x0C, 0xE0, 0x00, 0x00, 0x33, 0x00, 0x00, 0x01, 0x0C, 0x59, 0x87, 0x81, 0x99, 0x98, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x18, 0x1F, 
+        0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x1E, 0x01, 0x80, 0x00, 0x00, 0x00, 0x44, 0x55, 0x57, 0x74, 0x30, 0x0C, 0x03, 0x03, 
+        0x30, 0x00, 0x00, 0x0C, 0xC3, 0x30, 0x00, 0x33, 0x0C, 0xC0, 0xC0, 0x00, 0x11, 0x2A, 0xAD, 0xDC, 
+        0x30, 0x0C, 0x03, 0x03, 0x30, 0x00, 0x00, 0x0C, 0xC3, 0x30, 0x00, 0x33, 0x0C, 0xC0, 0xC0, 0x00, 
+        0x44, 0x55, 0x57, 0x74, 0x30, 0x0C, 0x3F, 0x03, 0x30, 0x00, 0xFC, 0x3C, 0xC3, 0x33, 0xFC, 0xF3, 
+        0x0C, 0xCF, 0xC0, 0x00, 0x11, 0x2A, 0xAD, 0xDC, 0x30, 0x0C, 0x3F, 0x03, 0x30, 0x00, 0xFC, 0x3C, 
+        0xC3, 0x33, 0xFC, 0xF3, 0x0C, 0xCF, 0xC0, 0x00, 0x44, 0x55, 0x57, 0x74, 0x30, 0xFC, 0x03, 0x0F, 
+        0x33, 0xFC, 0x0C, 0x00, 0xC3, 0x30, 0x0C, 0x03, 0x3F, 0xC0, 0xC3, 0xF0, 0x11, 0x2A, 0xAD, 0xDC, 
+        0x30, 0xFC, 0x03, 0x0F, 0x33, 0xFC, 0x0C, 0x00, 0xC3, 0x30, 0x0C, 0x03, 0x3F, 0xC0, 0xC3, 0xF0, 
+        0x44, 0x55, 0x57, 0x74, 0x30, 0x0C, 0x3F, 0x03, 0x30, 0xCC, 0xFC, 0x3C, 0xC3, 0x33, 0xCC, 0xFF, 
+        0x00, 0x0F, 0xC0, 0x30, 0x11, 0x2A, 0xAD, 0xDC, 0x30, 0x0C, 0x3F, 0x03, 0x30, 0xCC, 0xFC, 0x3C, 
+        0xC3, 0x33, 0xCC, 0xFF, 0x00, 0x0F, 0xC0, 0x30, 0x44, 0x55, 0x57, 0x74, 0x30, 0x0C, 0x03, 0x03, 
+        0x30, 0xCC, 0x0C, 0x0C, 0xC3, 0x30, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x30, 0x11, 0x2A, 0xAD, 0xDC, 
+        0x30, 0x0C, 0x03, 0x03, 0x30, 0xCC, 0x0C, 0x0C, 0xC3, 0x30, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x30, 
+        0x0C, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0xC0, 0xCC, 0x33, 0x00, 0x03, 0x30, 0x00, 0x33, 
+        0x00, 0x03, 0x30, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0xC0, 0xCC, 0x33, 0x00, 
+        0x03, 0x30, 0x00, 0x33, 0x00, 0x03, 0x30, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 
+        0xFC, 0xCC, 0x33, 0xCF, 0xFF, 0x3F, 0xFF, 0x33, 0xFF, 0xFF, 0x3F, 0xFF, 0x0C, 0x03, 0x00, 0x00, 
+        0x30, 0x00, 0x03, 0x00, 0xFC, 0xCC, 0x33, 0xCF, 0xFF, 0x3F, 0xFF, 0x33, 0xFF, 0xFF, 0x3F, 0xFF, 
+        0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xC0, 0xCF, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x30, 
+        0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xC0, 0xCF, 0x30, 0x0C, 
+        0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x03, 0x00, 
+        0xFC, 0xCC, 0x3F, 0xCC, 0xFF, 0xFF, 0xCF, 0x33, 0xFF, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0xC0, 
+        0x30, 0x00, 0x03, 0x00, 0xFC, 0xCC, 0x3F, 0xCC, 0xFF, 0xFF, 0xCF, 0x33, 0xFF, 0xFF, 0x3F, 0xFF, 
+        0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x03, 0x00, 0xC0, 0xCC, 0x00, 0x0C, 0xC0, 0x00, 0xCC, 0x33, 
+        0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0x03, 0x00, 0xC0, 0xCC, 0x00, 0x0C, 
+        0xC0, 0x00, 0xCC, 0x33, 0x00, 0x03, 0x30, 0x00, 0x33, 0x00, 0x00, 0x00, 0xCC, 0x0C, 0x00, 0x00, 
+        0x00, 0xCC, 0x0C, 0x03, 0x00, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0x33, 0x00, 0x00, 0x00, 
+        0xCC, 0x0C, 0x00, 0x00, 0x00, 0xCC, 0x0C, 0x03, 0x00, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 
+        0x33, 0x3F, 0xF0, 0x00, 0xCC, 0x0F, 0xC3, 0xF0, 0x00, 0xCC, 0xFF, 0xC3, 0x00, 0x03, 0xFF, 0x00, 
+        0x3E, 0x00, 0x7F, 0xFF, 0x33, 0x3F, 0xF0, 0x00, 0xCC, 0x0F, 0xC3, 0xF0, 0x00, 0xCC, 0xFF, 0xC3, 
+        0x00, 0x03, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 0xFF, 0x0C, 0x03, 0x03, 
+        0xFF, 0xCF, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFC, 
+        0xFF, 0x0C, 0x03, 0x03, 0xFF, 0xCF, 0x00, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 
+        0x00, 0x3F, 0xF3, 0x30, 0x00, 0x0F, 0xC3, 0xF3, 0x30, 0xCC, 0xFF, 0xC0, 0x00, 0xC3, 0xFF, 0xFF, 
+        0xFE, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0xF3, 0x30, 0x00, 0x0F, 0xC3, 0xF3, 0x30, 0xCC, 0xFF, 0xC0, 
+        0x00, 0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x03, 0x03, 0x30, 0x00, 0x00, 0x03, 0x03, 
+        0x30, 0xCC, 0x0C, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x03, 0x03, 0x30, 
+        0x00, 0x00, 0x03, 0x03, 0x30, 0xCC, 0x0C, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFE, 0x00, 0x7C, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xF1, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x07, 
+        0x83, 0xE0, 0x60, 0x00, 0x00, 0xC0, 0xF0, 0x78, 0x3B, 0x0C, 0xC3, 0x30, 0xD8, 0x31, 0x00, 0x00, 
+        0x00, 0x00, 0x0C, 0x0C, 0xC6, 0x30, 0x30, 0x3B, 0x0F, 0x81, 0x80, 0xCC, 0x6F, 0x0D, 0x83, 0x30, 
+        0xD8, 0x18, 0x07, 0xE3, 0x30, 0xEC, 0x1E, 0x0C, 0xC6, 0x30, 0x78, 0x6D, 0x9B, 0xC3, 0x00, 0xCC, 
+        0x66, 0x0C, 0xC3, 0x00, 0xD8, 0x0C, 0x0C, 0x83, 0x31, 0xB8, 0x33, 0x0F, 0xC6, 0x30, 0xCC, 0x6D, 
+        0x9A, 0xC3, 0xF0, 0xCC, 0x6F, 0x0C, 0xC3, 0x00, 0xD8, 0x18, 0x0C, 0xC3, 0x30, 0x30, 0x33, 0x0C, 
+        0xC3, 0x60, 0xCC, 0x37, 0x1E, 0xC3, 0x00, 0xCC, 0x3B, 0x0F, 0x83, 0x00, 0xD8, 0x31, 0x0C, 0xC3, 
+        0x30, 0x30, 0x1E, 0x0C, 0xC3, 0x60, 0xCC, 0x00, 0x0F, 0x81, 0x80, 0xCC, 0x00, 0x0C, 0x03, 0x00, 
+        0xCC, 0x3F, 0x07, 0x83, 0xD8, 0x30, 0x0C, 0x07, 0x87, 0x70, 0x78, 0x00, 0x18, 0x00, 0xF0, 0xCC, 
+        0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 
+        0x00, 0x0E, 0x01, 0x80, 0x00, 0xE2, 0x1C, 0x00, 0x00, 0x00, 0x1C, 0x36, 0x07, 0x00, 0x00, 0x00, 
+        0x00, 0x03, 0x01, 0x80, 0x18, 0x1B, 0x01, 0x80, 0xC1, 0xB6, 0x36, 0x00, 0x00, 0x00, 0x10, 0x1B, 
+        0x01, 0x83, 0xF0, 0xFC, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x1B, 0x01, 0x80, 0xC1, 0x1C, 0x36, 0x00, 
+        0x00, 0x00, 0x10, 0x1B, 0x03, 0x03, 0xF0, 0x84, 0x3F, 0x0F, 0xC0, 0x60, 0x60, 0x18, 0x01, 0x80, 
+        0x00, 0x00, 0x1C, 0x03, 0x00, 0x00, 0x90, 0x1B, 0x07, 0x83, 0xF0, 0x84, 0x00, 0x03, 0x00, 0xC0, 
+        0x30, 0x18, 0x01, 0x83, 0xF0, 0xE2, 0x00, 0x03, 0x00, 0xC0, 0xD0, 0x00, 0x00, 0x03, 0xF0, 0x84, 
+        0x00, 0x03, 0x01, 0x80, 0x18, 0x18, 0x0D, 0x80, 0x01, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 
+        0x00, 0x03, 0xF0, 0x84, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0D, 0x80, 0xC1, 0x1C, 0x00, 0x00, 
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x03, 0xF0, 0xFC, 0x00, 0x0F, 0xC3, 0xF0, 0xFC, 0x18, 0x07, 0x00, 
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
     };
 
-};
\ No newline at end of file
+    /* Metrics of each glyph of the atlas (glyph i is character i). */
+    constexpr impl::AtlasGlyph SEAG_CP437_GLYPHS[SEAG_CP437_GLYPH_COUNT] = {
+        { 0, 0, 0, 0, 5.0f, 10.0f },
+        { 10, 0, 1, 0, 8.0f, 9.0f },
+        { 20, 0, 1, 0, 8.0f, 9.0f },
+        { 30, 0, 1, 1, 8.0f, 8.0f },
+        { 40, 0, 1, 1, 8.0f, 8.0f },
+        { 50, 0, 1, 1, 8.0f, 9.0f },
+        { 60, 0, 1, 1, 8.0f, 9.0f },
+        { 70, 0, 2, 3, 6.0f, 4.0f },
+        { 80, 0, 0, 0, 10.0f, 10.0f },
+        { 90, 0, 2, 2, 6.0f, 6.0f },
+        { 100, 0, 0, 0, 10.0f, 10.0f },
+        { 110, 0, 1, 0, 7.0f, 9.0f },
+        { 120, 0, 2, 0, 6.0f, 9.0f },
+        { 130, 0, 1, 1, 8.0f, 8.0f },
+        { 140, 0, 0, 1, 9.0f, 8.0f },
+        { 150, 0, 1, 1, 8.0f, 7.0f },
+        { 0, 10, 1, 1, 8.0f, 7.0f },
+        { 10, 10, 1, 1, 8.0f, 7.0f },
+        { 20, 10, 2, 1, 6.0f, 8.0f },
+        { 30, 10, 2, 1, 6.0f, 7.0f },
+        { 40, 10, 1, 1, 8.0f, 7.0f },
+        { 50, 10, 1, 1, 8.0f, 8.0f },
+        { 60, 10, 2, 6, 6.0f, 3.0f },
+        { 70, 10, 2, 1, 6.0f, 8.0f },
+        { 80, 10, 2, 1, 6.0f, 8.0f },
+        { 90, 10, 2, 1, 6.0f, 8.0f },
+        { 100, 10, 1, 2, 8.0f, 6.0f },
+        { 110, 10, 1, 2, 8.0f, 6.0f },
+        { 120, 10, 2, 3, 6.0f, 4.0f },
+        { 130, 10, 1, 3, 8.0f, 5.0f },
+        { 140, 10, 1, 1, 7.0f, 8.0f },
+        { 150, 10, 1, 1, 7.0f, 8.0f },
+        { 0, 20, 0, 0, 5.0f, 10.0f },
+        { 10, 20, 3, 1, 4.0f, 8.0f },
+        { 20, 20, 2, 1, 6.0f, 3.0f },
+        { 30, 20, 1, 1, 7.0f, 8.0f },
+        { 40, 20, 2, 0, 6.0f, 9.0f },
+        { 50, 20, 2, 2, 7.0f, 6.0f },
+        { 60, 20, 2, 1, 7.0f, 7.0f },
+        { 70, 20, 4, 1, 3.0f, 3.0f },
+        { 80, 20, 3, 1, 4.0f, 7.0f },
+        { 90, 20, 3, 1, 4.0f, 7.0f },
+        { 100, 20, 1, 2, 8.0f, 5.0f },
+        { 110, 20, 2, 3, 6.0f, 5.0f },
+        { 120, 20, 3, 6, 3.0f, 3.0f },
+        { 130, 20, 2, 5, 6.0f, 1.0f },
+        { 140, 20, 4, 6, 2.0f, 2.0f },
+        { 150, 20, 1, 1, 7.0f, 8.0f },
+        { 0, 30, 2, 1, 6.0f, 7.0f },
+        { 10, 30, 2, 1, 6.0f, 7.0f },
+        { 20, 30, 2, 1, 6.0f, 7.0f },
+        { 30, 30, 2, 1, 6.0f, 7.0f },
+        { 40, 30, 2, 1, 7.0f, 7.0f },
+        { 50, 30, 2, 1, 6.0f, 7.0f },
+        { 60, 30, 2, 1, 6.0f, 7.0f },
+        { 70, 30, 2, 1, 6.0f, 7.0f },
+        { 80, 30, 2, 1, 6.0f, 7.0f },
+        { 90, 30, 2, 1, 6.0f, 7.0f },
+        { 100, 30, 4, 3, 2.0f, 5.0f },
+        { 110, 30, 3, 3, 3.0f, 6.0f },
+        { 120, 30, 2, 1, 5.0f, 8.0f },
+        { 130, 30, 2, 4, 6.0f, 3.0f },
+        { 140, 30, 3, 1, 5.0f, 8.0f },
+        { 150, 30, 2, 1, 6.0f, 7.0f },
+        { 0, 40, 2, 1, 6.0f, 7.0f },
+        { 10, 40, 2, 1, 6.0f, 7.0f },
+        { 20, 40, 1, 1, 7.0f, 7.0f },
+        { 30, 40, 1, 1, 7.0f, 7.0f },
+        { 40, 40, 1, 1, 8.0f, 7.0f },
+        { 50, 40, 1, 1, 7.0f, 7.0f },
+        { 60, 40, 1, 1, 7.0f, 7.0f },
+        { 70, 40, 1, 1, 7.0f, 7.0f },
+        { 80, 40, 2, 1, 6.0f, 7.0f },
+        { 90, 40, 3, 1, 4.0f, 7.0f },
+        { 100, 40, 1, 1, 7.0f, 7.0f },
+        { 110, 40, 1, 1, 8.0f, 7.0f },
+        { 120, 40, 1, 1, 7.0f, 7.0f },
+        { 130, 40, 1, 1, 7.0f, 7.0f },
+        { 140, 40, 1, 1, 7.0f, 7.0f },
+        { 150, 40, 1, 1, 7.0f, 7.0f },
+        { 0, 50, 1, 1, 7.0f, 7.0f },
+        { 10, 50, 1, 1, 7.0f, 7.0f },
+        { 20, 50, 1, 1, 7.0f, 7.0f },
+        { 30, 50, 2, 1, 6.0f, 7.0f },
+        { 40, 50, 2, 1, 6.0f, 7.0f },
+        { 50, 50, 2, 1, 6.0f, 7.0f },
+        { 60, 50, 2, 1, 6.0f, 7.0f },
+        { 70, 50, 1, 1, 7.0f, 7.0f },
+        { 80, 50, 2, 1, 6.0f, 7.0f },
+        { 90, 50, 2, 1, 6.0f, 7.0f },
+        { 100, 50, 2, 1, 6.0f, 7.0f },
+        { 110, 50, 3, 1, 4.0f, 7.0f },
+        { 120, 50, 1, 1, 7.0f, 8.0f },
+        { 130, 50, 3, 1, 4.0f, 7.0f },
+        { 140, 50, 1, 1, 7.0f, 4.0f },
+        { 150, 50, 1, 8, 8.0f, 1.0f },
+        { 0, 60, 3, 2, 3.0f, 3.0f },
+        { 10, 60, 1, 3, 7.0f, 5.0f },
+        { 20, 60, 1, 1, 7.0f, 7.0f },
+        { 30, 60, 2, 3, 6.0f, 5.0f },
+        { 40, 60, 2, 1, 6.0f, 7.0f },
+        { 50, 60, 2, 3, 6.0f, 5.0f },
+        { 60, 60, 2, 1, 6.0f, 7.0f },
+        { 70, 60, 1, 3, 7.0f, 6.0f },
+        { 80, 60, 1, 1, 7.0f, 7.0f },
+        { 90, 60, 2, 1, 6.0f, 7.0f },
+        { 100, 60, 2, 1, 6.0f, 7.0f },
+        { 110, 60, 1, 1, 7.0f, 7.0f },
+        { 120, 60, 2, 1, 6.0f, 7.0f },
+        { 130, 60, 1, 3, 7.0f, 5.0f },
+        { 140, 60, 2, 3, 6.0f, 5.0f },
+        { 150, 60, 2, 3, 6.0f, 5.0f },
+        { 0, 70, 1, 3, 7.0f, 7.0f },
+        { 10, 70, 1, 3, 7.0f, 7.0f },
+        { 20, 70, 1, 3, 7.0f, 5.0f },
+        { 30, 70, 2, 3, 6.0f, 5.0f },
+        { 40, 70, 2, 1, 6.0f, 7.0f },
+        { 50, 70, 2, 3, 7.0f, 5.0f },
+        { 60, 70, 2, 3, 6.0f, 5.0f },
+        { 70, 70, 1, 3, 7.0f, 5.0f },
+        { 80, 70, 1, 3, 7.0f, 5.0f },
+        { 90, 70, 2, 3, 6.0f, 6.0f },
+        { 100, 70, 2, 3, 6.0f, 5.0f },
+        { 110, 70, 3, 1, 5.0f, 7.0f },
+        { 120, 70, 4, 1, 2.0f, 7.0f },
+        { 130, 70, 2, 1, 5.0f, 7.0f },
+        { 140, 70, 1, 1, 7.0f, 4.0f },
+        { 150, 70, 1, 2, 7.0f, 6.0f },
+        { 0, 80, 2, 2, 6.0f, 7.0f },
+        { 10, 80, 2, 1, 7.0f, 7.0f },
+        { 20, 80, 2, 0, 6.0f, 8.0f },
+        { 30, 80, 2, 0, 7.0f, 8.0f },
+        { 40, 80, 2, 0, 7.0f, 8.0f },
+        { 50, 80, 2, 0, 7.0f, 8.0f },
+        { 60, 80, 2, 0, 7.0f, 8.0f },
+        { 70, 80, 2, 3, 6.0f, 7.0f },
+        { 80, 80, 2, 0, 6.0f, 8.0f },
+        { 90, 80, 2, 0, 6.0f, 8.0f },
+        { 100, 80, 2, 0, 6.0f, 8.0f },
+        { 110, 80, 3, 0, 6.0f, 8.0f },
+        { 120, 80, 3, 0, 6.0f, 8.0f },
+        { 130, 80, 2, 0, 6.0f, 8.0f },
+        { 140, 80, 2, 0, 6.0f, 8.0f },
+        { 150, 80, 2, 0, 6.0f, 8.0f },
+        { 0, 90, 2, 1, 6.0f, 7.0f },
+        { 10, 90, 1, 3, 8.0f, 5.0f },
+        { 20, 90, 1, 1, 8.0f, 7.0f },
+        { 30, 90, 2, 1, 6.0f, 7.0f },
+        { 40, 90, 2, 1, 6.0f, 7.0f },
+        { 50, 90, 2, 1, 6.0f, 7.0f },
+        { 60, 90, 2, 1, 6.0f, 7.0f },
+        { 70, 90, 2, 1, 6.0f, 7.0f },
+        { 80, 90, 2, 1, 6.0f, 8.0f },
+        { 90, 90, 2, 0, 6.0f, 8.0f },
+        { 100, 90, 2, 0, 6.0f, 8.0f },
+        { 110, 90, 2, 0, 6.0f, 9.0f },
+        { 120, 90, 1, 1, 7.0f, 7.0f },
+        { 130, 90, 2, 1, 6.0f, 8.0f },
+        { 140, 90, 1, 0, 8.0f, 9.0f },
+        { 150, 90, 1, 1, 8.0f, 7.0f },
+        { 0, 100, 2, 0, 7.0f, 8.0f },
+        { 10, 100, 3, 1, 6.0f, 7.0f },
+        { 20, 100, 2, 1, 6.0f, 7.0f },
+        { 30, 100, 2, 1, 6.0f, 7.0f },
+        { 40, 100, 2, 1, 7.0f, 7.0f },
+        { 50, 100, 2, 1, 7.0f, 7.0f },
+        { 60, 100, 2, 1, 7.0f, 6.0f },
+        { 70, 100, 2, 1, 7.0f, 6.0f },
+        { 80, 100, 2, 2, 6.0f, 7.0f },
+        { 90, 100, 2, 3, 6.0f, 4.0f },
+        { 100, 100, 2, 3, 6.0f, 4.0f },
+        { 110, 100, 1, 0, 8.0f, 10.0f },
+        { 120, 100, 1, 0, 8.0f, 10.0f },
+        { 130, 100, 3, 1, 4.0f, 8.0f },
+        { 140, 100, 1, 2, 8.0f, 6.0f },
+        { 150, 100, 1, 2, 8.0f, 6.0f },
+        { 0, 110, 1, 0, 9.0f, 10.0f },
+        { 10, 110, 0, 0, 10.0f, 10.0f },
+        { 20, 110, 0, 0, 10.0f, 10.0f },
+        { 30, 110, 4, 0, 2.0f, 10.0f },
+        { 40, 110, 0, 0, 6.0f, 10.0f },
+        { 50, 110, 0, 0, 6.0f, 10.0f },
+        { 60, 110, 0, 0, 8.0f, 10.0f },
+        { 70, 110, 0, 4, 8.0f, 6.0f },
+        { 80, 110, 0, 2, 6.0f, 8.0f },
+        { 90, 110, 0, 0, 8.0f, 10.0f },
+        { 100, 110, 2, 0, 6.0f, 10.0f },
+        { 110, 110, 0, 2, 8.0f, 8.0f },
+        { 120, 110, 0, 0, 8.0f, 8.0f },
+        { 130, 110, 0, 0, 8.0f, 6.0f },
+        { 140, 110, 0, 0, 6.0f, 8.0f },
+        { 150, 110, 0, 4, 6.0f, 6.0f },
+        { 0, 120, 4, 0, 6.0f, 6.0f },
+        { 10, 120, 0, 0, 10.0f, 6.0f },
+        { 20, 120, 0, 4, 10.0f, 6.0f },
+        { 30, 120, 4, 0, 6.0f, 10.0f },
+        { 40, 120, 0, 4, 10.0f, 2.0f },
+        { 50, 120, 0, 0, 10.0f, 10.0f },
+        { 60, 120, 4, 0, 6.0f, 10.0f },
+        { 70, 120, 2, 0, 8.0f, 10.0f },
+        { 80, 120, 2, 0, 8.0f, 8.0f },
+        { 90, 120, 2, 2, 8.0f, 8.0f },
+        { 100, 120, 0, 0, 10.0f, 8.0f },
+        { 110, 120, 0, 2, 10.0f, 8.0f },
+        { 120, 120, 2, 0, 8.0f, 10.0f },
+        { 130, 120, 0, 2, 10.0f, 6.0f },
+        { 140, 120, 0, 0, 10.0f, 10.0f },
+        { 150, 120, 0, 0, 10.0f, 8.0f },
+        { 0, 130, 0, 0, 10.0f, 6.0f },
+        { 10, 130, 0, 2, 10.0f, 8.0f },
+        { 20, 130, 0, 4, 10.0f, 6.0f },
+        { 30, 130, 2, 0, 8.0f, 6.0f },
+        { 40, 130, 4, 0, 6.0f, 8.0f },
+        { 50, 130, 4, 2, 6.0f, 8.0f },
+        { 60, 130, 2, 4, 8.0f, 6.0f },
+        { 70, 130, 0, 0, 10.0f, 10.0f },
+        { 80, 130, 0, 0, 10.0f, 10.0f },
+        { 90, 130, 0, 0, 6.0f, 6.0f },
+        { 100, 130, 4, 4, 6.0f, 6.0f },
+        { 110, 130, 0, 0, 10.0f, 10.0f },
+        { 120, 130, 0, 5, 10.0f, 5.0f },
+        { 130, 130, 0, 0, 5.0f, 10.0f },
+        { 140, 130, 5, 0, 5.0f, 10.0f },
+        { 150, 130, 0, 0, 10.0f, 5.0f },
+        { 0, 140, 1, 2, 7.0f, 5.0f },
+        { 10, 140, 2, 1, 6.0f, 8.0f },
+        { 20, 140, 2, 1, 6.0f, 7.0f },
+        { 30, 140, 1, 1, 7.0f, 7.0f },
+        { 40, 140, 2, 1, 6.0f, 7.0f },
+        { 50, 140, 2, 3, 7.0f, 5.0f },
+        { 60, 140, 1, 3, 8.0f, 7.0f },
+        { 70, 140, 1, 3, 7.0f, 6.0f },
+        { 80, 140, 2, 1, 6.0f, 8.0f },
+        { 90, 140, 2, 1, 6.0f, 7.0f },
+        { 100, 140, 1, 1, 7.0f, 7.0f },
+        { 110, 140, 2, 0, 6.0f, 8.0f },
+        { 120, 140, 1, 2, 8.0f, 4.0f },
+        { 130, 140, 1, 1, 7.0f, 7.0f },
+        { 140, 140, 2, 1, 6.0f, 7.0f },
+        { 150, 140, 2, 1, 6.0f, 7.0f },
+        { 0, 150, 2, 1, 6.0f, 7.0f },
+        { 10, 150, 2, 2, 6.0f, 7.0f },
+        { 20, 150, 2, 2, 6.0f, 7.0f },
+        { 30, 150, 2, 2, 6.0f, 7.0f },
+        { 40, 150, 3, 1, 5.0f, 9.0f },
+        { 50, 150, 2, 0, 5.0f, 9.0f },
+        { 60, 150, 2, 2, 6.0f, 7.0f },
+        { 70, 150, 1, 1, 8.0f, 7.0f },
+        { 80, 150, 2, 1, 5.0f, 4.0f },
+        { 90, 150, 4, 4, 2.0f, 2.0f },
+        { 100, 150, 4, 5, 2.0f, 1.0f },
+        { 110, 150, 2, 1, 6.0f, 7.0f },
+        { 120, 150, 2, 1, 6.0f, 4.0f },
+        { 130, 150, 3, 1, 4.0f, 4.0f },
+        { 140, 150, 2, 2, 6.0f, 6.0f },
+        { 150, 150, 2, 2, 6.0f, 6.0f },
+    };
+}